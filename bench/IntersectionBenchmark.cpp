@@ -0,0 +1,96 @@
+/*
+ * Microbenchmark of the SetIntersection kernels. Intersects pairs of random sorted arrays of
+ * balanced and skewed lengths with every kernel the processor supports, plus the automatic
+ * choice of SetIntersection::intersect, and prints the time per pair.
+ * Usage: intersectionBenchmark [pairs]
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "SetIntersection.h"
+
+using namespace graphpp;
+
+typedef SetIntersection::Value Value;
+
+static std::vector<Value> randomSet(std::mt19937& random, std::size_t size, Value range)
+{
+    std::uniform_int_distribution<Value> draw(0, range - 1);
+    std::vector<Value> values;
+    while (values.size() < size)
+    {
+        values.push_back(draw(random));
+        if (values.size() == size)
+        {
+            std::sort(values.begin(), values.end());
+            values.erase(std::unique(values.begin(), values.end()), values.end());
+        }
+    }
+    return values;
+}
+
+int main(int argc, char** argv)
+{
+    const unsigned int pairs = argc > 1 ? std::atoi(argv[1]) : 2000;
+    const struct
+    {
+        std::size_t shorter;
+        std::size_t longer;
+    } shapes[] = {{16, 16}, {64, 64}, {1024, 1024}, {16, 1024}, {64, 16384}};
+    const struct
+    {
+        const char* name;
+        int kernel;
+    } kernels[] = {{"merge", SetIntersection::MERGE},
+                   {"galloping", SetIntersection::GALLOPING},
+                   {"sse", SetIntersection::SSE},
+                   {"avx2", SetIntersection::AVX2},
+                   {"auto", -1}};
+
+    std::printf("%12s %12s %12s %14s\n", "kernel", "|a|", "|b|", "ns per pair");
+    std::mt19937 random(42);
+    for (const auto& shape : shapes)
+    {
+        // Values spread over 4 times the longer length, so about a quarter are common.
+        std::vector<std::vector<Value>> a;
+        std::vector<std::vector<Value>> b;
+        for (unsigned int i = 0; i < pairs; ++i)
+        {
+            a.push_back(randomSet(random, shape.shorter, 4 * shape.longer));
+            b.push_back(randomSet(random, shape.longer, 4 * shape.longer));
+        }
+
+        for (const auto& kernel : kernels)
+        {
+            const auto chosen = SetIntersection::Kernel(kernel.kernel);
+            if (kernel.kernel >= 0 && !SetIntersection::available(chosen))
+                continue;
+            std::size_t common = 0;
+            auto count = [&common](const Value*, const Value*) { ++common; };
+            const auto start = std::chrono::steady_clock::now();
+            for (unsigned int i = 0; i < pairs; ++i)
+            {
+                const Value* aBegin = a[i].data();
+                const Value* bBegin = b[i].data();
+                if (kernel.kernel < 0)
+                    SetIntersection::intersect(
+                        aBegin, aBegin + a[i].size(), bBegin, bBegin + b[i].size(), count);
+                else
+                    SetIntersection::intersect(
+                        chosen, aBegin, aBegin + a[i].size(), bBegin, bBegin + b[i].size(),
+                        count);
+            }
+            const double elapsed = std::chrono::duration<double, std::nano>(
+                                       std::chrono::steady_clock::now() - start)
+                                       .count();
+            std::printf(
+                "%12s %12zu %12zu %14.1f   (%zu common)\n", kernel.name, shape.shorter,
+                shape.longer, elapsed / pairs, common);
+        }
+    }
+    return 0;
+}
@@ -10,6 +10,7 @@
 #include "AdjacencyListGraph.h"
 #include "AdjacencyListVertex.h"
 #include "IGraphFactory.h"
+#include "TriangleCounting.h"
 
 using namespace graphpp;
 
@@ -23,6 +24,24 @@ private:
     Graph graph;
     bool directed_out;
     bool directed_in;
+    unsigned int threads;
+    double betweennessEpsilon;
+    double betweennessDelta;
+    double betweennessSeconds;
+    std::string betweennessCheckpoint;
+    double checkpointInterval;
+    double betweennessHorizon;
+    double clusteringEpsilon;
+    double clusteringDelta;
+    std::size_t clusteringSamples;
+    WeightedClustering weightedClustering;
+
+    IBetweenness<Graph, Vertex>* createBetweenness(IGraphFactory<Graph, Vertex>* factory);
+    IBetweenness<WeightedGraph, WeightedVertex>* createBetweenness(
+        IGraphFactory<WeightedGraph, WeightedVertex>* factory);
+    IShellIndex<Graph, Vertex>* createShellIndex(IGraphFactory<Graph, Vertex>* factory);
+    IClusteringCoefficient<Graph, Vertex>* createClusteringCoefficient(
+        IGraphFactory<Graph, Vertex>* factory);
 
     void computeBetweenness(PropertyMap& propertyMap);
     void computeDegreeDistribution(PropertyMap& propertyMap);
@@ -39,6 +58,12 @@ public:
 
     void setWeighted(bool weighted);
     void setDigraph(bool digraph);
+    void setThreads(unsigned int threads);
+    void setBetweennessSampling(double epsilon, double delta, double seconds);
+    void setBetweennessCheckpoint(std::string path, double seconds);
+    void setBetweennessHorizon(double k);
+    void setClusteringSampling(double epsilon, double delta, std::size_t samples);
+    void setWeightedClustering(WeightedClustering definition);
 
     bool isWeighted();
     bool isDigraph();
@@ -60,6 +85,7 @@ public:
     double degreeDistribution(unsigned int vertex_id);
     double clustering(unsigned int vertex_id);
     double knn(unsigned int vertex_id);
+    double assortativity();
     double shellIndex(unsigned int vertex_id);
     std::list<int> maxCliqueExact(unsigned int max_time);
     std::list<int> maxCliqueAprox();
@@ -73,11 +99,18 @@ public:
     void exportMaxCliqueAprox(std::string outputPath);
     void exportCurrentGraph(std::string outputPath);
     void exportBetweennessVsDegree(std::string outputPath);
+    void exportEdgeBetweenness(std::string outputPath);
     void exportDegreeDistribution(
         std::string outputPath, unsigned int log_bin_given = false, unsigned int binsAmount = -1);
     void exportClusteringVsDegree(std::string outputPath);
+    void exportClusteringSummary(std::string outputPath);
     void exportNearestNeighborsDegreeVsDegree(std::string outputPath);
     void exportShellIndexVsDegree(std::string outputPath);
+    void exportTrussNumbers(std::string outputPath);
+    void exportTrussDistribution(std::string outputPath);
+    void exportDCoreDistribution(std::string outputPath);
+    void exportCloseness(std::string outputPath);
+    void exportDistanceDistribution(std::string outputPath);
     void exportCCBoxplot(std::string outputPath);
 
     void setDirectedInOut(bool o, bool i);
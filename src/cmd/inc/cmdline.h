@@ -180,6 +180,72 @@ struct gengetopt_args_info
     const char *output_file_help; /**< @brief Save the result in an output file help description. */
     const char
         *print_deg_help; /**< @brief Print node degree for power law regression help description. */
+    int threads_arg; /**< @brief Number of worker threads for the parallel analyses (0 uses all
+                        cores) (default='0').  */
+    char *threads_orig; /**< @brief Number of worker threads for the parallel analyses (0 uses all
+                           cores) original value given at command line.  */
+    const char *threads_help; /**< @brief Number of worker threads for the parallel analyses (0
+                                 uses all cores) help description.  */
+    float betweenness_epsilon_arg; /**< @brief Estimate the betweenness by sampling, within this
+                                      error of the normalized values. */
+    char *betweenness_epsilon_orig; /**< @brief Estimate the betweenness by sampling, within this
+                                       error of the normalized values original value given at
+                                       command line. */
+    const char *betweenness_epsilon_help; /**< @brief Estimate the betweenness by sampling, within
+                                             this error of the normalized values help description.
+                                             */
+    float betweenness_delta_arg; /**< @brief Probability that the sampled betweenness exceeds the
+                                    error (default='0.1'). */
+    char *betweenness_delta_orig; /**< @brief Probability that the sampled betweenness exceeds the
+                                     error original value given at command line. */
+    const char *betweenness_delta_help; /**< @brief Probability that the sampled betweenness exceeds
+                                           the error help description. */
+    float betweenness_time_arg; /**< @brief Estimate the betweenness by sampling for this many
+                                   seconds. */
+    char *betweenness_time_orig; /**< @brief Estimate the betweenness by sampling for this many
+                                    seconds original value given at command line. */
+    const char *betweenness_time_help; /**< @brief Estimate the betweenness by sampling for this
+                                          many seconds help description. */
+    const char *edge_betweenness_output_help; /**< @brief Betweenness of every edge help
+                                                 description. */
+    char *betweenness_checkpoint_arg; /**< @brief Save the betweenness progress to this file and
+                                         resume from it if it exists. */
+    char *betweenness_checkpoint_orig; /**< @brief Save the betweenness progress to this file and
+                                          resume from it if it exists original value given at
+                                          command line. */
+    const char *betweenness_checkpoint_help; /**< @brief Save the betweenness progress to this file
+                                                and resume from it if it exists help description. */
+    float checkpoint_interval_arg; /**< @brief Seconds between two betweenness checkpoints
+                                      (default='600'). */
+    char *checkpoint_interval_orig; /**< @brief Seconds between two betweenness checkpoints original
+                                       value given at command line. */
+    const char *checkpoint_interval_help; /**< @brief Seconds between two betweenness checkpoints
+                                             help description. */
+    float betweenness_horizon_arg; /**< @brief Only count shortest paths of at most this length, in
+                                      hops or total weight. */
+    char *betweenness_horizon_orig; /**< @brief Only count shortest paths of at most this length, in
+                                       hops or total weight original value given at command line. */
+    const char *betweenness_horizon_help; /**< @brief Only count shortest paths of at most this
+                                             length, in hops or total weight help description. */
+    const char *truss_output_help; /**< @brief Truss number of every edge help description.  */
+    const char *truss_dist_output_help; /**< @brief Truss number distribution help description.  */
+    const char *dcore_output_help; /**< @brief Size of every (k, l)-D-core of a directed graph help
+                                      description. */
+    float clustering_epsilon_arg; /**< @brief Estimate the clustering coefficients by sampling wedges, within this error.  */
+    char *clustering_epsilon_orig; /**< @brief Estimate the clustering coefficients by sampling wedges, within this error original value given at command line.  */
+    const char *clustering_epsilon_help; /**< @brief Estimate the clustering coefficients by sampling wedges, within this error help description.  */
+    float clustering_delta_arg; /**< @brief Probability that the sampled clustering coefficients exceed the error (default='0.1').  */
+    char *clustering_delta_orig; /**< @brief Probability that the sampled clustering coefficients exceed the error original value given at command line.  */
+    const char *clustering_delta_help; /**< @brief Probability that the sampled clustering coefficients exceed the error help description.  */
+    int clustering_samples_arg; /**< @brief Estimate the clustering coefficients from this many sampled wedges each.  */
+    char *clustering_samples_orig; /**< @brief Estimate the clustering coefficients from this many sampled wedges each original value given at command line.  */
+    const char *clustering_samples_help; /**< @brief Estimate the clustering coefficients from this many sampled wedges each help description.  */
+    const char *closeness_output_help; /**< @brief Closeness of every vertex, by hop count help description.  */
+    const char *distance_output_help; /**< @brief Number of ordered pairs of vertices at every distance, by hop count help description.  */
+    const char *clustering_summary_output_help; /**< @brief Transitivity and average clustering coefficient, with the error of sampled estimates help description.  */
+    char *weighted_clustering_arg; /**< @brief Definition of the weighted clustering coefficient: barrat or onnela (default='barrat').  */
+    char *weighted_clustering_orig; /**< @brief Definition of the weighted clustering coefficient: barrat or onnela original value given at command line.  */
+    const char *weighted_clustering_help; /**< @brief Definition of the weighted clustering coefficient: barrat or onnela help description.  */
 
     unsigned int help_given;               /**< @brief Whether help was given.  */
     unsigned int version_given;            /**< @brief Whether version was given.  */
@@ -222,6 +288,26 @@ struct gengetopt_args_info
         maxCliqueAprox_output_given; /**< @brief Whether maxCliqueAprox-output was given.  */
     unsigned int output_file_given;  /**< @brief Whether output-file was given.  */
     unsigned int print_deg_given;    /**< @brief Whether print-deg was given.  */
+    unsigned int threads_given;      /**< @brief Whether threads was given.  */
+    unsigned int betweenness_epsilon_given; /**< @brief Whether betweenness-epsilon was given.  */
+    unsigned int betweenness_delta_given; /**< @brief Whether betweenness-delta was given.  */
+    unsigned int betweenness_time_given; /**< @brief Whether betweenness-time was given.  */
+    unsigned int edge_betweenness_output_given; /**< @brief Whether edge-betweenness-output was
+                                                   given. */
+    unsigned int betweenness_checkpoint_given; /**< @brief Whether betweenness-checkpoint was given.
+                                                  */
+    unsigned int checkpoint_interval_given; /**< @brief Whether checkpoint-interval was given.  */
+    unsigned int betweenness_horizon_given; /**< @brief Whether betweenness-horizon was given.  */
+    unsigned int truss_output_given; /**< @brief Whether truss-output was given.  */
+    unsigned int truss_dist_output_given; /**< @brief Whether truss-dist-output was given.  */
+    unsigned int dcore_output_given; /**< @brief Whether dcore-output was given.  */
+    unsigned int clustering_epsilon_given; /**< @brief Whether clustering-epsilon was given.  */
+    unsigned int clustering_delta_given; /**< @brief Whether clustering-delta was given.  */
+    unsigned int clustering_samples_given; /**< @brief Whether clustering-samples was given.  */
+    unsigned int closeness_output_given; /**< @brief Whether closeness-output was given.  */
+    unsigned int distance_output_given; /**< @brief Whether distance-output was given.  */
+    unsigned int clustering_summary_output_given; /**< @brief Whether clustering-summary-output was given.  */
+    unsigned int weighted_clustering_given; /**< @brief Whether weighted-clustering was given.  */
 
     int analysis_group_counter;     /**< @brief Counter for group analysis */
     int directed_group_counter;     /**< @brief Counter for group directed */
@@ -3,6 +3,8 @@
 // Last modification: December 19th, 2012.
 
 #include "ProgramState.h"
+#include "ApproximateBetweenness.h"
+#include "ApproximateClustering.h"
 #include "DegreeDistribution.h"
 #include "DirectedDegreeDistribution.h"
 #include "DirectedGraphFactory.h"
@@ -11,9 +13,13 @@
 #include "GraphWriter.h"
 #include "IBetweenness.h"
 #include "IClusteringCoefficient.h"
+#include "IDCoreDecomposition.h"
 #include "IGraphFactory.h"
 #include "INearestNeighborsDegree.h"
 #include "IShellIndex.h"
+#include "IShortestPathLengths.h"
+#include "ITrussDecomposition.h"
+#include "ParallelFor.h"
 #include "PropertyMap.h"
 #include "WeightedGraphFactory.h"
 #include "GrapherUtils.h"
@@ -25,6 +31,47 @@ using namespace ComplexNetsGui;
 ProgramState::ProgramState()
 {
     setWeighted(false);
+    setThreads(0);
+    setBetweennessSampling(0.0, 0.0, 0.0);
+    setBetweennessCheckpoint("", 0.0);
+    setBetweennessHorizon(0.0);
+    setClusteringSampling(0.0, 0.0, 0);
+    setWeightedClustering(BARRAT);
+}
+
+void ProgramState::setThreads(unsigned int threads)
+{
+    this->threads = threads;
+}
+
+void ProgramState::setBetweennessSampling(double epsilon, double delta, double seconds)
+{
+    this->betweennessEpsilon = epsilon;
+    this->betweennessDelta = delta;
+    this->betweennessSeconds = seconds;
+}
+
+void ProgramState::setClusteringSampling(double epsilon, double delta, std::size_t samples)
+{
+    this->clusteringEpsilon = epsilon;
+    this->clusteringDelta = delta;
+    this->clusteringSamples = samples;
+}
+
+void ProgramState::setWeightedClustering(WeightedClustering definition)
+{
+    this->weightedClustering = definition;
+}
+
+void ProgramState::setBetweennessCheckpoint(std::string path, double seconds)
+{
+    this->betweennessCheckpoint = path;
+    this->checkpointInterval = seconds;
+}
+
+void ProgramState::setBetweennessHorizon(double k)
+{
+    this->betweennessHorizon = k;
 }
 
 void ProgramState::setWeighted(bool weighted)
@@ -118,7 +165,7 @@ double ProgramState::betweenness(unsigned int vertex_id)
     if (this->weighted)
     {
         auto wfactory = new WeightedGraphFactory<WeightedGraph, WeightedVertex>();
-        auto wbetweenness = wfactory->createBetweenness(this->weightedGraph);
+        auto wbetweenness = createBetweenness(wfactory);
         auto wit = wbetweenness->iterator();
 
         double ret = -1;
@@ -138,7 +185,7 @@ double ProgramState::betweenness(unsigned int vertex_id)
     else
     {
         auto factory = new GraphFactory<Graph, Vertex>();
-        auto betweenness = factory->createBetweenness(this->graph);
+        auto betweenness = createBetweenness(factory);
         auto it = betweenness->iterator();
 
         double ret = -1;
@@ -157,6 +204,56 @@ double ProgramState::betweenness(unsigned int vertex_id)
     }
 }
 
+IBetweenness<Graph, Vertex>* ProgramState::createBetweenness(
+    IGraphFactory<Graph, Vertex>* factory)
+{
+    if (!betweennessCheckpoint.empty())
+        return factory->createCheckpointedBetweenness(
+            this->graph, betweennessCheckpoint, checkpointInterval, this->threads);
+    if (betweennessHorizon > 0.0)
+        return factory->createBoundedBetweenness(this->graph, betweennessHorizon, this->threads);
+    if (betweennessEpsilon <= 0.0 && betweennessSeconds <= 0.0)
+        return factory->createBetweenness(this->graph, this->threads);
+
+    auto betweenness = factory->createApproximateBetweenness(
+        this->graph, betweennessEpsilon, betweennessDelta, betweennessSeconds, this->threads);
+    auto approximation = dynamic_cast<ApproximateBetweenness<Graph, Vertex>*>(betweenness);
+    if (approximation != nullptr)
+        std::cout << "Approximate betweenness from " << approximation->samples()
+                  << " sampled shortest paths, epsilon = " << approximation->epsilon()
+                  << " with probability " << 1.0 - betweennessDelta << "." << std::endl;
+    return betweenness;
+}
+
+IBetweenness<WeightedGraph, WeightedVertex>* ProgramState::createBetweenness(
+    IGraphFactory<WeightedGraph, WeightedVertex>* factory)
+{
+    if (!betweennessCheckpoint.empty())
+        return factory->createCheckpointedBetweenness(
+            this->weightedGraph, betweennessCheckpoint, checkpointInterval, this->threads);
+    if (betweennessHorizon > 0.0)
+        return factory->createBoundedBetweenness(
+            this->weightedGraph, betweennessHorizon, this->threads);
+    return factory->createBetweenness(this->weightedGraph, this->threads);
+}
+
+IClusteringCoefficient<Graph, Vertex>* ProgramState::createClusteringCoefficient(
+    IGraphFactory<Graph, Vertex>* factory)
+{
+    if (clusteringEpsilon <= 0.0 && clusteringSamples == 0)
+        return factory->createClusteringCoefficient();
+
+    auto clusteringCoefficient = factory->createApproximateClusteringCoefficient(
+        clusteringEpsilon, clusteringDelta, clusteringSamples);
+    auto approximation =
+        dynamic_cast<ApproximateClusteringCoefficient<Graph, Vertex>*>(clusteringCoefficient);
+    if (approximation != nullptr)
+        std::cout << "Approximate clustering from " << approximation->samples()
+                  << " sampled wedges per estimate, epsilon = " << approximation->epsilon()
+                  << " with probability " << 1.0 - clusteringDelta << "." << std::endl;
+    return clusteringCoefficient;
+}
+
 std::list<int> ProgramState::maxCliqueAprox()
 {
     auto factory = new GraphFactory<Graph, Vertex>();
@@ -198,7 +295,8 @@ double ProgramState::clustering(unsigned int vertex_id)
         if ((vertex = weightedGraph.getVertexById(vertex_id)) != nullptr)
         {
             auto factory = new WeightedGraphFactory<WeightedGraph, WeightedVertex>();
-            auto clusteringCoefficient = factory->createClusteringCoefficient();
+            auto clusteringCoefficient =
+                factory->createClusteringCoefficient(weightedGraph, weightedClustering);
             ret = clusteringCoefficient->vertexClusteringCoefficient(vertex);
             delete clusteringCoefficient;
             delete factory;
@@ -222,7 +320,7 @@ double ProgramState::clustering(unsigned int vertex_id)
         if ((vertex = graph.getVertexById(vertex_id)) != nullptr)
         {
             auto factory = new GraphFactory<Graph, Vertex>();
-            auto clusteringCoefficient = factory->createClusteringCoefficient();
+            auto clusteringCoefficient = createClusteringCoefficient(factory);
             ret = clusteringCoefficient->vertexClusteringCoefficient(vertex);
             delete clusteringCoefficient;
             delete factory;
@@ -274,11 +372,43 @@ double ProgramState::knn(unsigned int vertex_id)
     return ret;
 }
 
-double ProgramState::shellIndex(unsigned int vertex_id)
+double ProgramState::assortativity()
+{
+    double ret = 0;
+    if (this->isWeighted())
+    {
+        auto factory = new WeightedGraphFactory<WeightedGraph, WeightedVertex>();
+        auto nearestNeighborsDegree = factory->createNearestNeighborsDegree();
+        ret = nearestNeighborsDegree->degreeCorrelations(weightedGraph, this->threads)
+                  .assortativity;
+        delete nearestNeighborsDegree;
+        delete factory;
+    }
+    else if (this->isDigraph())
+    {
+        auto factory = new DirectedGraphFactory<DirectedGraph, DirectedVertex>();
+        auto nearestNeighborsDegree = factory->createNearestNeighborsDegree();
+        ret = nearestNeighborsDegree
+                  ->degreeCorrelations(directedGraph, directed_out, directed_in, this->threads)
+                  .assortativity;
+        delete nearestNeighborsDegree;
+        delete factory;
+    }
+    else
+    {
+        auto factory = new GraphFactory<Graph, Vertex>();
+        auto nearestNeighborsDegree = factory->createNearestNeighborsDegree();
+        ret = nearestNeighborsDegree->degreeCorrelations(graph, this->threads).assortativity;
+        delete nearestNeighborsDegree;
+        delete factory;
+    }
+    return ret;
+}
+
+template <class Graph, class Vertex>
+static double findShellIndex(IShellIndex<Graph, Vertex>* shellIndex, unsigned int vertex_id)
 {
     double ret = -1;
-    auto factory = new GraphFactory<Graph, Vertex>();
-    auto shellIndex = factory->createShellIndex(graph);
     auto it = shellIndex->iterator();
 
     while (!it.end())
@@ -290,8 +420,28 @@ double ProgramState::shellIndex(unsigned int vertex_id)
         }
         ++it;
     }
-    delete shellIndex;
-    delete factory;
+    return ret;
+}
+
+double ProgramState::shellIndex(unsigned int vertex_id)
+{
+    double ret;
+    if (isWeighted())
+    {
+        auto wfactory = new WeightedGraphFactory<WeightedGraph, WeightedVertex>();
+        auto shellIndex = wfactory->createShellIndex(this->weightedGraph);
+        ret = findShellIndex(shellIndex, vertex_id);
+        delete shellIndex;
+        delete wfactory;
+    }
+    else
+    {
+        auto factory = new GraphFactory<Graph, Vertex>();
+        auto shellIndex = createShellIndex(factory);
+        ret = findShellIndex(shellIndex, vertex_id);
+        delete shellIndex;
+        delete factory;
+    }
     return ret;
 }
 
@@ -395,7 +545,7 @@ void ProgramState::computeBetweenness(PropertyMap& propertyMap)
     if (this->weighted)
     {
         auto wfactory = new WeightedGraphFactory<WeightedGraph, WeightedVertex>();
-        auto wbetweenness = wfactory->createBetweenness(this->weightedGraph);
+        auto wbetweenness = createBetweenness(wfactory);
         auto betweennessIterator = wbetweenness->iterator();
 
         while (!betweennessIterator.end())
@@ -426,7 +576,7 @@ void ProgramState::computeBetweenness(PropertyMap& propertyMap)
     else
     {
         auto factory = new GraphFactory<Graph, Vertex>();
-        auto betweenness = factory->createBetweenness(this->graph);
+        auto betweenness = createBetweenness(factory);
         auto betweennessIterator = betweenness->iterator();
 
         while (!betweennessIterator.end())
@@ -584,6 +734,15 @@ void ProgramState::computeDegreeDistribution(PropertyMap& propertyMap)
     }
 }
 
+// Mean of every group of a grouped per-vertex measure, keyed by degree.
+static std::map<unsigned int, double> groupMeans(const std::vector<Boxplotentry>& groups)
+{
+    std::map<unsigned int, double> means;
+    for (const Boxplotentry& group : groups)
+        means[group.degree] = group.mean;
+    return means;
+}
+
 void ProgramState::computeClusteringCoefficient(PropertyMap& propertyMap)
 {
     if (!propertyMap.containsPropertySet("degreeDistribution"))
@@ -616,12 +775,14 @@ void ProgramState::computeClusteringCoefficient(PropertyMap& propertyMap)
     if (isWeighted())
     {
         auto weightedFactory = new WeightedGraphFactory<WeightedGraph, WeightedVertex>();
-        auto clusteringCoefficient = weightedFactory->createClusteringCoefficient();
+        auto clusteringCoefficient =
+            weightedFactory->createClusteringCoefficient(weightedGraph, weightedClustering);
+        std::map<unsigned int, double> byDegree = groupMeans(
+            clusteringCoefficient->clusteringCoefficientByDegree(weightedGraph, this->threads));
 
         while (it != degrees.end())
         {
-            cc = clusteringCoefficient->clusteringCoefficient(
-                weightedGraph, from_string<unsigned int>(it->first));
+            cc = byDegree[from_string<unsigned int>(it->first)];
             propertyMap.addProperty<double>("clusteringCoeficientForDegree", it->first, cc);
             ++it;
         }
@@ -633,11 +794,13 @@ void ProgramState::computeClusteringCoefficient(PropertyMap& propertyMap)
     {
         auto directedFactory = new DirectedGraphFactory<DirectedGraph, DirectedVertex>();
         auto clusteringCoefficient = directedFactory->createClusteringCoefficient();
+        std::map<unsigned int, double> byDegree =
+            groupMeans(clusteringCoefficient->clusteringCoefficientByDegree(
+                directedGraph, directed_out, directed_in, this->threads));
 
         while (it != degrees.end())
         {
-            cc = clusteringCoefficient->clusteringCoefficient(
-                directedGraph, from_string<unsigned int>(it->first), directed_out, directed_in);
+            cc = byDegree[from_string<unsigned int>(it->first)];
             propertyMap.addProperty<double>(
                 "clusteringCoeficientForDegree" + getDirectedPostfix(), it->first, cc);
             ++it;
@@ -649,12 +812,13 @@ void ProgramState::computeClusteringCoefficient(PropertyMap& propertyMap)
     else
     {
         auto factory = new GraphFactory<Graph, Vertex>();
-        auto clusteringCoefficient = factory->createClusteringCoefficient();
+        auto clusteringCoefficient = createClusteringCoefficient(factory);
+        std::map<unsigned int, double> byDegree =
+            groupMeans(clusteringCoefficient->clusteringCoefficientByDegree(graph, this->threads));
 
         while (it != degrees.end())
         {
-            cc = clusteringCoefficient->clusteringCoefficient(
-                graph, from_string<unsigned int>(it->first));
+            cc = byDegree[from_string<unsigned int>(it->first)];
             propertyMap.addProperty<double>("clusteringCoeficientForDegree", it->first, cc);
             ++it;
         }
@@ -697,11 +861,12 @@ void ProgramState::computeNearestNeighborsDegree(PropertyMap& propertyMap)
     {
         auto weightedFactory = new WeightedGraphFactory<WeightedGraph, WeightedVertex>();
         auto nearestNeighborDegree = weightedFactory->createNearestNeighborsDegree();
+        const DegreeCorrelations correlations =
+            nearestNeighborDegree->degreeCorrelations(weightedGraph, this->threads);
 
         while (it != degrees.end())
         {
-            knn = nearestNeighborDegree->meanDegree(
-                weightedGraph, from_string<unsigned int>(it->first));
+            knn = correlations.meanDegree(from_string<unsigned int>(it->first));
             propertyMap.addProperty<double>("nearestNeighborDegreeForDegree", it->first, knn);
             ++it;
         }
@@ -713,11 +878,12 @@ void ProgramState::computeNearestNeighborsDegree(PropertyMap& propertyMap)
     {
         auto directedFactory = new DirectedGraphFactory<DirectedGraph, DirectedVertex>();
         auto nearestNeighborDegree = directedFactory->createNearestNeighborsDegree();
+        const DegreeCorrelations correlations = nearestNeighborDegree->degreeCorrelations(
+            directedGraph, directed_out, directed_in, this->threads);
 
         while (it != degrees.end())
         {
-            knn = nearestNeighborDegree->meanDegree(
-                directedGraph, from_string<unsigned int>(it->first), directed_out, directed_in);
+            knn = correlations.meanDegree(from_string<unsigned int>(it->first));
             propertyMap.addProperty<double>(
                 "nearestNeighborDegreeForDegree" + getDirectedPostfix(), it->first, knn);
             ++it;
@@ -730,10 +896,12 @@ void ProgramState::computeNearestNeighborsDegree(PropertyMap& propertyMap)
     {
         auto factory = new GraphFactory<Graph, Vertex>();
         auto nearestNeighborDegree = factory->createNearestNeighborsDegree();
+        const DegreeCorrelations correlations =
+            nearestNeighborDegree->degreeCorrelations(graph, this->threads);
 
         while (it != degrees.end())
         {
-            knn = nearestNeighborDegree->meanDegree(graph, from_string<unsigned int>(it->first));
+            knn = correlations.meanDegree(from_string<unsigned int>(it->first));
             propertyMap.addProperty<double>("nearestNeighborDegreeForDegree", it->first, knn);
             ++it;
         }
@@ -743,10 +911,35 @@ void ProgramState::computeNearestNeighborsDegree(PropertyMap& propertyMap)
     }
 }
 
+IShellIndex<Graph, Vertex>* ProgramState::createShellIndex(IGraphFactory<Graph, Vertex>* factory)
+{
+    if (ParallelFor::threadCount(this->threads) > 1)
+        return factory->createParallelShellIndex(this->graph, this->threads);
+    return factory->createShellIndex(this->graph);
+}
+
 void ProgramState::computeShellIndex(PropertyMap& propertyMap)
 {
+    if (isWeighted())
+    {
+        auto wfactory = new WeightedGraphFactory<WeightedGraph, WeightedVertex>();
+        auto shellIndex = wfactory->createShellIndex(this->weightedGraph);
+        auto it = shellIndex->iterator();
+
+        while (!it.end())
+        {
+            propertyMap.addProperty<double>(
+                "shellIndex", to_string<unsigned int>(it->first), it->second);
+            ++it;
+        }
+
+        delete shellIndex;
+        delete wfactory;
+        return;
+    }
+
     auto factory = new GraphFactory<Graph, Vertex>();
-    auto shellIndex = factory->createShellIndex(graph);
+    auto shellIndex = createShellIndex(factory);
     auto it = shellIndex->iterator();
 
     while (!it.end())
@@ -828,6 +1021,197 @@ void ProgramState::exportBetweennessVsDegree(std::string outputPath)
     utils.exportPropertySet(propertyMap.getPropertySet("betweennessVsDegree"), outputPath);
 }
 
+template <class Graph, class Vertex>
+static void writeEdgeBetweenness(
+    IEdgeBetweenness<Graph, Vertex>* edgeBetweenness, bool directed, std::string outputPath)
+{
+    std::ofstream destinationFile(outputPath.c_str(), std::ios_base::out);
+    auto it = edgeBetweenness->edgesIterator();
+
+    // Undirected edges are listed in both directions; write them once.
+    while (!it.end())
+    {
+        if (directed || it->from < it->to)
+            destinationFile << it->from << " " << it->to << " " << it->betweenness << std::endl;
+        ++it;
+    }
+}
+
+void ProgramState::exportEdgeBetweenness(std::string outputPath)
+{
+    if (this->weighted)
+    {
+        auto wfactory = new WeightedGraphFactory<WeightedGraph, WeightedVertex>();
+        auto edgeBetweenness = wfactory->createEdgeBetweenness(this->weightedGraph, this->threads);
+        writeEdgeBetweenness(edgeBetweenness, false, outputPath);
+        delete edgeBetweenness;
+        delete wfactory;
+    }
+    else if (this->digraph)
+    {
+        auto dfactory = new DirectedGraphFactory<DirectedGraph, DirectedVertex>();
+        auto edgeBetweenness = dfactory->createEdgeBetweenness(this->directedGraph, this->threads);
+        writeEdgeBetweenness(edgeBetweenness, true, outputPath);
+        delete edgeBetweenness;
+        delete dfactory;
+    }
+    else
+    {
+        auto factory = new GraphFactory<Graph, Vertex>();
+        auto edgeBetweenness = factory->createEdgeBetweenness(this->graph, this->threads);
+        writeEdgeBetweenness(edgeBetweenness, false, outputPath);
+        delete edgeBetweenness;
+        delete factory;
+    }
+}
+
+template <class Graph, class Vertex>
+static void writeTrussNumbers(ITrussDecomposition<Graph, Vertex>* truss, std::string outputPath)
+{
+    std::ofstream destinationFile(outputPath.c_str(), std::ios_base::out);
+    auto it = truss->edgesIterator();
+    while (!it.end())
+    {
+        destinationFile << it->from << " " << it->to << " " << it->truss << std::endl;
+        ++it;
+    }
+}
+
+template <class Graph, class Vertex>
+static void writeTrussDistribution(
+    ITrussDecomposition<Graph, Vertex>* truss, std::string outputPath)
+{
+    std::ofstream destinationFile(outputPath.c_str(), std::ios_base::out);
+    auto it = truss->distribution();
+    while (!it.end())
+    {
+        destinationFile << it->first << " " << it->second << std::endl;
+        ++it;
+    }
+}
+
+void ProgramState::exportTrussNumbers(std::string outputPath)
+{
+    if (this->weighted)
+    {
+        auto wfactory = new WeightedGraphFactory<WeightedGraph, WeightedVertex>();
+        auto truss = wfactory->createTrussDecomposition(this->weightedGraph, this->threads);
+        writeTrussNumbers(truss, outputPath);
+        delete truss;
+        delete wfactory;
+    }
+    else
+    {
+        auto factory = new GraphFactory<Graph, Vertex>();
+        auto truss = factory->createTrussDecomposition(this->graph, this->threads);
+        writeTrussNumbers(truss, outputPath);
+        delete truss;
+        delete factory;
+    }
+}
+
+void ProgramState::exportTrussDistribution(std::string outputPath)
+{
+    if (this->weighted)
+    {
+        auto wfactory = new WeightedGraphFactory<WeightedGraph, WeightedVertex>();
+        auto truss = wfactory->createTrussDecomposition(this->weightedGraph, this->threads);
+        writeTrussDistribution(truss, outputPath);
+        delete truss;
+        delete wfactory;
+    }
+    else
+    {
+        auto factory = new GraphFactory<Graph, Vertex>();
+        auto truss = factory->createTrussDecomposition(this->graph, this->threads);
+        writeTrussDistribution(truss, outputPath);
+        delete truss;
+        delete factory;
+    }
+}
+
+void ProgramState::exportDCoreDistribution(std::string outputPath)
+{
+    auto dfactory = new DirectedGraphFactory<DirectedGraph, DirectedVertex>();
+    auto dcores = dfactory->createDCoreDecomposition(this->directedGraph);
+    std::ofstream destinationFile(outputPath.c_str(), std::ios_base::out);
+    auto it = dcores->distribution();
+    while (!it.end())
+    {
+        destinationFile << it->first.first << " " << it->first.second << " " << it->second
+                        << std::endl;
+        ++it;
+    }
+    delete dcores;
+    delete dfactory;
+}
+
+template <class Graph, class Vertex>
+static void writeCloseness(IShortestPathLengths<Graph, Vertex>* lengths, std::string outputPath)
+{
+    std::ofstream destinationFile(outputPath.c_str(), std::ios_base::out);
+    auto it = lengths->closenessIterator();
+    while (!it.end())
+    {
+        destinationFile << it->first << " " << it->second << std::endl;
+        ++it;
+    }
+}
+
+template <class Graph, class Vertex>
+static void writeDistances(IShortestPathLengths<Graph, Vertex>* lengths, std::string outputPath)
+{
+    std::ofstream destinationFile(outputPath.c_str(), std::ios_base::out);
+    auto it = lengths->distanceIterator();
+    while (!it.end())
+    {
+        // Pair counts are whole numbers, written in full rather than in scientific notation.
+        destinationFile << it->first << " " << static_cast<unsigned long long>(it->second)
+                        << std::endl;
+        ++it;
+    }
+}
+
+void ProgramState::exportCloseness(std::string outputPath)
+{
+    if (this->digraph)
+    {
+        auto dfactory = new DirectedGraphFactory<DirectedGraph, DirectedVertex>();
+        auto lengths = dfactory->createShortestPathLengths(this->directedGraph, this->threads);
+        writeCloseness(lengths, outputPath);
+        delete lengths;
+        delete dfactory;
+    }
+    else
+    {
+        auto factory = new GraphFactory<Graph, Vertex>();
+        auto lengths = factory->createShortestPathLengths(this->graph, this->threads);
+        writeCloseness(lengths, outputPath);
+        delete lengths;
+        delete factory;
+    }
+}
+
+void ProgramState::exportDistanceDistribution(std::string outputPath)
+{
+    if (this->digraph)
+    {
+        auto dfactory = new DirectedGraphFactory<DirectedGraph, DirectedVertex>();
+        auto lengths = dfactory->createShortestPathLengths(this->directedGraph, this->threads);
+        writeDistances(lengths, outputPath);
+        delete lengths;
+        delete dfactory;
+    }
+    else
+    {
+        auto factory = new GraphFactory<Graph, Vertex>();
+        auto lengths = factory->createShortestPathLengths(this->graph, this->threads);
+        writeDistances(lengths, outputPath);
+        delete lengths;
+        delete factory;
+    }
+}
+
 void ProgramState::exportDegreeDistribution(
     std::string outputPath, unsigned int log_bin_given, unsigned int binsAmount)
 {
@@ -888,6 +1272,60 @@ void ProgramState::exportClusteringVsDegree(std::string outputPath)
         outputPath);
 }
 
+template <class Graph, class Vertex>
+static void writeClusteringSummary(
+    IClusteringCoefficient<Graph, Vertex>* clusteringCoefficient, Graph& g, unsigned int threads,
+    std::string outputPath)
+{
+    typedef typename ApproximateClusteringCoefficient<Graph, Vertex>::Estimate Estimate;
+    const char* names[] = {"transitivity", "average"};
+    Estimate estimates[2];
+    auto approximation =
+        dynamic_cast<ApproximateClusteringCoefficient<Graph, Vertex>*>(clusteringCoefficient);
+    if (approximation != nullptr)
+    {
+        estimates[0] = approximation->transitivityEstimate(g, threads);
+        estimates[1] = approximation->averageClusteringEstimate(g, threads);
+    }
+    else
+    {
+        estimates[0] = Estimate{clusteringCoefficient->transitivity(g, threads), 0.0};
+        estimates[1] =
+            Estimate{clusteringCoefficient->averageClusteringCoefficient(g, threads), 0.0};
+    }
+
+    // Sampled values are written with the error they are guaranteed within.
+    std::ofstream destinationFile(outputPath.c_str(), std::ios_base::out);
+    for (unsigned int i = 0; i < 2; i++)
+    {
+        destinationFile << names[i] << " " << estimates[i].value;
+        if (estimates[i].error > 0.0)
+            destinationFile << " +/- " << estimates[i].error;
+        destinationFile << std::endl;
+    }
+}
+
+void ProgramState::exportClusteringSummary(std::string outputPath)
+{
+    if (isWeighted())
+    {
+        auto weightedFactory = new WeightedGraphFactory<WeightedGraph, WeightedVertex>();
+        auto clusteringCoefficient =
+            weightedFactory->createClusteringCoefficient(weightedGraph, weightedClustering);
+        writeClusteringSummary(clusteringCoefficient, weightedGraph, this->threads, outputPath);
+        delete clusteringCoefficient;
+        delete weightedFactory;
+    }
+    else
+    {
+        auto factory = new GraphFactory<Graph, Vertex>();
+        auto clusteringCoefficient = createClusteringCoefficient(factory);
+        writeClusteringSummary(clusteringCoefficient, graph, this->threads, outputPath);
+        delete clusteringCoefficient;
+        delete factory;
+    }
+}
+
 std::string ProgramState::getDirectedPostfix()
 {
     std::string directedPostfix;
@@ -937,11 +1375,13 @@ void ProgramState::exportShellIndexVsDegree(std::string outputPath)
     while (shellIt != shellIndex.end())
     {
         vertexId = from_string<unsigned int>(shellIt->first);
-        Vertex* v = graph.getVertexById(vertexId);
-        shellAuxAcum = shellIndexVsDegree.get_element<double>(to_string<unsigned int>(v->degree()));
+        const unsigned int degree = isWeighted()
+                                        ? weightedGraph.getVertexById(vertexId)->degree()
+                                        : graph.getVertexById(vertexId)->degree();
+        shellAuxAcum = shellIndexVsDegree.get_element<double>(to_string<unsigned int>(degree));
         shellIndexVsDegree.insert<double>(
-            to_string<unsigned int>(v->degree()),
-            shellAuxAcum + from_string<unsigned int>(shellIt->second));
+            to_string<unsigned int>(degree),
+            shellAuxAcum + from_string<double>(shellIt->second));
 
         ++shellIt;
     }
@@ -1036,23 +1476,19 @@ graphpp::Boxplotentry ProgramState::computeTotalBpEntriesDegreeDistribution()
 
 graphpp::Boxplotentry ProgramState::computeTotalBpEntriesShellIndex()
 {
-    Graph& g = graph;
-    Graph::VerticesIterator vit = g.verticesIterator();
     std::vector<double> bCoefs;
     PropertyMap propertyMap;
     computeShellIndex(propertyMap);
-    // IShellIndex<Graph, Vertex>* betweenness = factory->createShellIndex(g);
     double coefSums = 0.0;
     unsigned int count = 0;
 
-    while (!vit.end())
+    // Weighted graphs have real s-core numbers, so every value is read as a double.
+    VariantsSet& shellIndex = propertyMap.getPropertySet("shellIndex");
+    for (VariantsSet::const_iterator it = shellIndex.begin(); it != shellIndex.end(); ++it)
     {
-        Vertex* v = *vit;
-        int c =
-            propertyMap.getProperty<int>("shellIndex", to_string<unsigned int>(v->getVertexId()));
+        double c = from_string<double>(it->second);
         bCoefs.push_back(c);
         coefSums += c;
-        ++vit;
         count++;
     }
     std::sort(bCoefs.begin(), bCoefs.end());
@@ -1118,127 +1554,24 @@ graphpp::Boxplotentry ProgramState::computeTotalBpEntriesBetweenness()
 
 graphpp::Boxplotentry ProgramState::computeTotalBpEntriesKnn()
 {
-    Graph& g = graph;
-    Graph::VerticesIterator vit = g.verticesIterator();
-    std::vector<double> nnCoefs;
-    PropertyMap propertyMap;
-    computeDegreeDistribution(propertyMap);
     auto factory = new GraphFactory<Graph, Vertex>();
     auto nearestNeighborDegree = factory->createNearestNeighborsDegree();
-    double coefSums = 0.0;
-    unsigned int count = 0;
+    graphpp::Boxplotentry entry = graphpp::Boxplotentry::summarize(
+        0, nearestNeighborDegree->vertexMeanDegrees(graph, this->threads));
 
+    delete nearestNeighborDegree;
     delete factory;
-
-    double oldCoef;
-    int degree_exists = propertyMap.containsPropertySet("nearestNeighborDegreeForDegreeO") ? 1 : 0;
-
-    while (!vit.end())
-    {
-        Vertex* v = *vit;
-        if (!propertyMap.containsProperty(
-                "nearestNeighborDegreeForDegreeO", to_string<unsigned int>(v->degree())))
-        {
-            oldCoef = 0;
-        }
-        else
-        {
-            oldCoef = propertyMap.getProperty<double>(
-                "nearestNeighborDegreeForDegreeO", to_string<unsigned int>(v->degree()));
-        }
-        double c = nearestNeighborDegree->meanDegreeForVertex(v);
-        propertyMap.addProperty<double>(
-            "nearestNeighborDegreeForVertex", to_string<unsigned int>(v->getVertexId()), c);
-        if (degree_exists == 0)
-            propertyMap.addProperty<double>(
-                "nearestNeighborDegreeForDegreeO", to_string<unsigned int>(v->degree()),
-                oldCoef + (c / propertyMap.getProperty<double>(
-                                   "degreeDistribution", to_string<unsigned int>(v->degree()))));
-        nnCoefs.push_back(c);
-        coefSums += c;
-        ++vit;
-        count++;
-    }
-    std::sort(nnCoefs.begin(), nnCoefs.end());
-    graphpp::Boxplotentry entry;
-    if (nnCoefs.size() > 0)
-    {
-        entry.mean = count == 0 ? 0 : coefSums / count;
-        entry.min = nnCoefs.front();
-        entry.max = nnCoefs.back();
-        int const Q1 = nnCoefs.size() / 4;
-        int const Q2 = nnCoefs.size() / 2;
-        int const Q3 = nnCoefs.size() * (0.75);
-        entry.Q1 = nnCoefs.at(Q1);
-        entry.Q2 = nnCoefs.at(Q2);
-        entry.Q3 = nnCoefs.at(Q3);
-        for (auto& coef : nnCoefs)
-            entry.values.push_back(coef);
-    }
-    nnCoefs.clear();
     return entry;
 }
 
 graphpp::Boxplotentry ProgramState::computeTotalBpEntries()
 {
-    Graph& g = graph;
-    Graph::VerticesIterator vit = g.verticesIterator();
-    std::vector<double> clusteringCoefs;
-    PropertyMap propertyMap;
-    computeDegreeDistribution(propertyMap);
-
     auto factory = new GraphFactory<Graph, Vertex>();
-    auto clusteringCoefficient = factory->createClusteringCoefficient();
+    auto clusteringCoefficient = createClusteringCoefficient(factory);
+    graphpp::Boxplotentry entry = graphpp::Boxplotentry::summarize(
+        0, clusteringCoefficient->vertexClusteringCoefficients(graph, this->threads));
 
+    delete clusteringCoefficient;
     delete factory;
-
-    double coefSums = 0.0;
-    unsigned int count = 0;
-    double oldCoef;
-    int degree_exists = propertyMap.containsPropertySet("clusteringCoeficientForDegreeO") ? 1 : 0;
-
-    while (!vit.end())
-    {
-        Vertex* v = *vit;
-        if (!propertyMap.containsProperty(
-                "clusteringCoeficientForDegreeO", to_string<unsigned int>(v->degree())))
-        {
-            oldCoef = 0;
-        }
-        else
-        {
-            oldCoef = propertyMap.getProperty<double>(
-                "clusteringCoeficientForDegreeO", to_string<unsigned int>(v->degree()));
-        }
-        double c = clusteringCoefficient->vertexClusteringCoefficient(v);
-        propertyMap.addProperty<double>(
-            "clusteringCoeficientForVertex", to_string<unsigned int>(v->getVertexId()), c);
-        if (degree_exists == 0)
-            propertyMap.addProperty<double>(
-                "clusteringCoeficientForDegreeO", to_string<unsigned int>(v->degree()),
-                oldCoef + (c / propertyMap.getProperty<double>(
-                                   "degreeDistribution", to_string<unsigned int>(v->degree()))));
-        clusteringCoefs.push_back(c);
-        coefSums += c;
-        ++vit;
-        count++;
-    }
-    std::sort(clusteringCoefs.begin(), clusteringCoefs.end());
-    graphpp::Boxplotentry entry;
-    if (clusteringCoefs.size() > 0)
-    {
-        entry.mean = count == 0 ? 0 : coefSums / count;
-        entry.min = clusteringCoefs.front();
-        entry.max = clusteringCoefs.back();
-        int const Q1 = clusteringCoefs.size() / 4;
-        int const Q2 = clusteringCoefs.size() / 2;
-        int const Q3 = clusteringCoefs.size() * (0.75);
-        entry.Q1 = clusteringCoefs.at(Q1);
-        entry.Q2 = clusteringCoefs.at(Q2);
-        entry.Q3 = clusteringCoefs.at(Q3);
-        for (auto& coef : clusteringCoefs)
-            entry.values.push_back(coef);
-    }
-    clusteringCoefs.clear();
     return entry;
 }
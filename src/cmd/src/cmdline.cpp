@@ -76,6 +76,24 @@ const char *gengetopt_args_info_help[] = {
   "      --maxCliqueAprox-output   ",
   "  -o, --output-file=<filename>  Save the result in an output file",
   "      --print-deg               Print node degree for power law regression",
+  "      --threads=<number>        Number of worker threads for the parallel\n                                  analyses (0 uses all cores)  (default=`0')",
+  "      --betweenness-epsilon=<epsilon>\n                                Estimate the betweenness by sampling, within\n                                  this error of the normalized values",
+  "      --betweenness-delta=<delta>\n                                Probability that the sampled betweenness exceeds\n                                  the error  (default=`0.1')",
+  "      --betweenness-time=<seconds>\n                                Estimate the betweenness by sampling for this\n                                  many seconds",
+  "      --edge-betweenness-output\n                                Betweenness of every edge",
+  "      --betweenness-checkpoint=filename\n                                Save the betweenness progress to this file and\n                                  resume from it if it exists",
+  "      --checkpoint-interval=seconds\n                                Seconds between two betweenness checkpoints\n                                  (default=`600')",
+  "      --betweenness-horizon=length\n                                Only count shortest paths of at most this\n                                  length, in hops or total weight",
+  "      --truss-output            Truss number of every edge",
+  "      --truss-dist-output       Truss number distribution",
+  "      --dcore-output            Size of every (k, l)-D-core of a directed graph",
+  "      --clustering-epsilon=<epsilon>\n                                Estimate the clustering coefficients by sampling\n                                  wedges, within this error",
+  "      --clustering-delta=<delta>\n                                Probability that the sampled clustering\n                                  coefficients exceed the error\n                                  (default=`0.1')",
+  "      --clustering-samples=<number>\n                                Estimate the clustering coefficients from this\n                                  many sampled wedges each",
+  "      --closeness-output        Closeness of every vertex, by hop count",
+  "      --distance-output         Number of ordered pairs of vertices at every\n                                  distance, by hop count",
+  "      --clustering-summary-output\n                                Transitivity and average clustering coefficient,\n                                  with the error of sampled estimates",
+  "      --weighted-clustering=<definition>\n                                Definition of the weighted clustering\n                                  coefficient: barrat or onnela\n                                  (default=`barrat')",
     0
 };
 
@@ -143,6 +161,24 @@ void clear_given (struct gengetopt_args_info *args_info)
   args_info->maxCliqueAprox_output_given = 0 ;
   args_info->output_file_given = 0 ;
   args_info->print_deg_given = 0 ;
+  args_info->threads_given = 0 ;
+  args_info->betweenness_epsilon_given = 0 ;
+  args_info->betweenness_delta_given = 0 ;
+  args_info->betweenness_time_given = 0 ;
+  args_info->edge_betweenness_output_given = 0 ;
+  args_info->betweenness_checkpoint_given = 0 ;
+  args_info->checkpoint_interval_given = 0 ;
+  args_info->betweenness_horizon_given = 0 ;
+  args_info->truss_output_given = 0 ;
+  args_info->truss_dist_output_given = 0 ;
+  args_info->dcore_output_given = 0 ;
+  args_info->clustering_epsilon_given = 0 ;
+  args_info->clustering_delta_given = 0 ;
+  args_info->clustering_samples_given = 0 ;
+  args_info->closeness_output_given = 0 ;
+  args_info->distance_output_given = 0 ;
+  args_info->clustering_summary_output_given = 0 ;
+  args_info->weighted_clustering_given = 0 ;
   args_info->analysis_group_counter = 0 ;
   args_info->directed_group_counter = 0 ;
   args_info->model_group_counter = 0 ;
@@ -182,6 +218,23 @@ void clear_args (struct gengetopt_args_info *args_info)
   args_info->maxCliqueExact_output_orig = NULL;
   args_info->output_file_arg = NULL;
   args_info->output_file_orig = NULL;
+  args_info->threads_arg = 0;
+  args_info->threads_orig = NULL;
+  args_info->betweenness_epsilon_orig = NULL;
+  args_info->betweenness_delta_arg = 0.1;
+  args_info->betweenness_delta_orig = NULL;
+  args_info->betweenness_time_orig = NULL;
+  args_info->betweenness_checkpoint_arg = NULL;
+  args_info->betweenness_checkpoint_orig = NULL;
+  args_info->checkpoint_interval_arg = 600;
+  args_info->checkpoint_interval_orig = NULL;
+  args_info->betweenness_horizon_orig = NULL;
+  args_info->clustering_epsilon_orig = NULL;
+  args_info->clustering_delta_arg = 0.1;
+  args_info->clustering_delta_orig = NULL;
+  args_info->clustering_samples_orig = NULL;
+  args_info->weighted_clustering_arg = gengetopt_strdup ("barrat");
+  args_info->weighted_clustering_orig = NULL;
   
 }
 
@@ -229,6 +282,24 @@ void init_args_info(struct gengetopt_args_info *args_info)
   args_info->maxCliqueAprox_output_help = gengetopt_args_info_help[39] ;
   args_info->output_file_help = gengetopt_args_info_help[40] ;
   args_info->print_deg_help = gengetopt_args_info_help[41] ;
+  args_info->threads_help = gengetopt_args_info_help[42] ;
+  args_info->betweenness_epsilon_help = gengetopt_args_info_help[43] ;
+  args_info->betweenness_delta_help = gengetopt_args_info_help[44] ;
+  args_info->betweenness_time_help = gengetopt_args_info_help[45] ;
+  args_info->edge_betweenness_output_help = gengetopt_args_info_help[46] ;
+  args_info->betweenness_checkpoint_help = gengetopt_args_info_help[47] ;
+  args_info->checkpoint_interval_help = gengetopt_args_info_help[48] ;
+  args_info->betweenness_horizon_help = gengetopt_args_info_help[49] ;
+  args_info->truss_output_help = gengetopt_args_info_help[50] ;
+  args_info->truss_dist_output_help = gengetopt_args_info_help[51] ;
+  args_info->dcore_output_help = gengetopt_args_info_help[52] ;
+  args_info->clustering_epsilon_help = gengetopt_args_info_help[53] ;
+  args_info->clustering_delta_help = gengetopt_args_info_help[54] ;
+  args_info->clustering_samples_help = gengetopt_args_info_help[55] ;
+  args_info->closeness_output_help = gengetopt_args_info_help[56] ;
+  args_info->distance_output_help = gengetopt_args_info_help[57] ;
+  args_info->clustering_summary_output_help = gengetopt_args_info_help[58] ;
+  args_info->weighted_clustering_help = gengetopt_args_info_help[59] ;
   
 }
 
@@ -335,6 +406,19 @@ cmdline_parser_release (struct gengetopt_args_info *args_info)
   free_string_field (&(args_info->maxCliqueExact_output_orig));
   free_string_field (&(args_info->output_file_arg));
   free_string_field (&(args_info->output_file_orig));
+  free_string_field (&(args_info->threads_orig));
+  free_string_field (&(args_info->betweenness_epsilon_orig));
+  free_string_field (&(args_info->betweenness_delta_orig));
+  free_string_field (&(args_info->betweenness_time_orig));
+  free_string_field (&(args_info->betweenness_checkpoint_arg));
+  free_string_field (&(args_info->betweenness_checkpoint_orig));
+  free_string_field (&(args_info->checkpoint_interval_orig));
+  free_string_field (&(args_info->betweenness_horizon_orig));
+  free_string_field (&(args_info->clustering_epsilon_orig));
+  free_string_field (&(args_info->clustering_delta_orig));
+  free_string_field (&(args_info->clustering_samples_orig));
+  free_string_field (&(args_info->weighted_clustering_arg));
+  free_string_field (&(args_info->weighted_clustering_orig));
   
   
 
@@ -443,6 +527,42 @@ cmdline_parser_dump(FILE *outfile, struct gengetopt_args_info *args_info)
     write_into_file(outfile, "output-file", args_info->output_file_orig, 0);
   if (args_info->print_deg_given)
     write_into_file(outfile, "print-deg", 0, 0 );
+  if (args_info->threads_given)
+    write_into_file(outfile, "threads", args_info->threads_orig, 0);
+  if (args_info->betweenness_epsilon_given)
+    write_into_file(outfile, "betweenness-epsilon", args_info->betweenness_epsilon_orig, 0);
+  if (args_info->betweenness_delta_given)
+    write_into_file(outfile, "betweenness-delta", args_info->betweenness_delta_orig, 0);
+  if (args_info->betweenness_time_given)
+    write_into_file(outfile, "betweenness-time", args_info->betweenness_time_orig, 0);
+  if (args_info->edge_betweenness_output_given)
+    write_into_file(outfile, "edge-betweenness-output", 0, 0 );
+  if (args_info->betweenness_checkpoint_given)
+    write_into_file(outfile, "betweenness-checkpoint", args_info->betweenness_checkpoint_orig, 0);
+  if (args_info->checkpoint_interval_given)
+    write_into_file(outfile, "checkpoint-interval", args_info->checkpoint_interval_orig, 0);
+  if (args_info->betweenness_horizon_given)
+    write_into_file(outfile, "betweenness-horizon", args_info->betweenness_horizon_orig, 0);
+  if (args_info->truss_output_given)
+    write_into_file(outfile, "truss-output", 0, 0 );
+  if (args_info->truss_dist_output_given)
+    write_into_file(outfile, "truss-dist-output", 0, 0 );
+  if (args_info->dcore_output_given)
+    write_into_file(outfile, "dcore-output", 0, 0 );
+  if (args_info->clustering_epsilon_given)
+    write_into_file(outfile, "clustering-epsilon", args_info->clustering_epsilon_orig, 0);
+  if (args_info->clustering_delta_given)
+    write_into_file(outfile, "clustering-delta", args_info->clustering_delta_orig, 0);
+  if (args_info->clustering_samples_given)
+    write_into_file(outfile, "clustering-samples", args_info->clustering_samples_orig, 0);
+  if (args_info->closeness_output_given)
+    write_into_file(outfile, "closeness-output", 0, 0 );
+  if (args_info->distance_output_given)
+    write_into_file(outfile, "distance-output", 0, 0 );
+  if (args_info->clustering_summary_output_given)
+    write_into_file(outfile, "clustering-summary-output", 0, 0 );
+  if (args_info->weighted_clustering_given)
+    write_into_file(outfile, "weighted-clustering", args_info->weighted_clustering_orig, 0);
   
 
   i = EXIT_SUCCESS;
@@ -697,6 +817,46 @@ cmdline_parser_required2 (struct gengetopt_args_info *args_info, const char *pro
       fprintf (stderr, "%s: '--maxCliqueAprox-output' option depends on option 'output-file'%s\n", prog_name, (additional_error ? additional_error : ""));
       error_occurred = 1;
     }
+  if (args_info->edge_betweenness_output_given && ! args_info->output_file_given)
+    {
+      fprintf (stderr, "%s: '--edge-betweenness-output' option depends on option 'output-file'%s\n", prog_name, (additional_error ? additional_error : ""));
+      error_occurred = 1;
+    }
+  if (args_info->checkpoint_interval_given && ! args_info->betweenness_checkpoint_given)
+    {
+      fprintf (stderr, "%s: '--checkpoint-interval' option depends on option 'betweenness-checkpoint'%s\n", prog_name, (additional_error ? additional_error : ""));
+      error_occurred = 1;
+    }
+  if (args_info->truss_output_given && ! args_info->output_file_given)
+    {
+      fprintf (stderr, "%s: '--truss-output' option depends on option 'output-file'%s\n", prog_name, (additional_error ? additional_error : ""));
+      error_occurred = 1;
+    }
+  if (args_info->truss_dist_output_given && ! args_info->output_file_given)
+    {
+      fprintf (stderr, "%s: '--truss-dist-output' option depends on option 'output-file'%s\n", prog_name, (additional_error ? additional_error : ""));
+      error_occurred = 1;
+    }
+  if (args_info->dcore_output_given && ! args_info->output_file_given)
+    {
+      fprintf (stderr, "%s: '--dcore-output' option depends on option 'output-file'%s\n", prog_name, (additional_error ? additional_error : ""));
+      error_occurred = 1;
+    }
+  if (args_info->closeness_output_given && ! args_info->output_file_given)
+    {
+      fprintf (stderr, "%s: '--closeness-output' option depends on option 'output-file'%s\n", prog_name, (additional_error ? additional_error : ""));
+      error_occurred = 1;
+    }
+  if (args_info->distance_output_given && ! args_info->output_file_given)
+    {
+      fprintf (stderr, "%s: '--distance-output' option depends on option 'output-file'%s\n", prog_name, (additional_error ? additional_error : ""));
+      error_occurred = 1;
+    }
+  if (args_info->clustering_summary_output_given && ! args_info->output_file_given)
+    {
+      fprintf (stderr, "%s: '--clustering-summary-output' option depends on option 'output-file'%s\n", prog_name, (additional_error ? additional_error : ""));
+      error_occurred = 1;
+    }
 
   return error_occurred;
 }
@@ -898,6 +1058,24 @@ cmdline_parser_internal (
         { "maxCliqueAprox-output",	0, NULL, 0 },
         { "output-file",	1, NULL, 'o' },
         { "print-deg",	0, NULL, 0 },
+        { "threads",	1, NULL, 0 },
+        { "betweenness-epsilon",	1, NULL, 0 },
+        { "betweenness-delta",	1, NULL, 0 },
+        { "betweenness-time",	1, NULL, 0 },
+        { "edge-betweenness-output",	0, NULL, 0 },
+        { "betweenness-checkpoint",	1, NULL, 0 },
+        { "checkpoint-interval",	1, NULL, 0 },
+        { "betweenness-horizon",	1, NULL, 0 },
+        { "truss-output",	0, NULL, 0 },
+        { "truss-dist-output",	0, NULL, 0 },
+        { "dcore-output",	0, NULL, 0 },
+        { "clustering-epsilon",	1, NULL, 0 },
+        { "clustering-delta",	1, NULL, 0 },
+        { "clustering-samples",	1, NULL, 0 },
+        { "closeness-output",	0, NULL, 0 },
+        { "distance-output",	0, NULL, 0 },
+        { "clustering-summary-output",	0, NULL, 0 },
+        { "weighted-clustering",	1, NULL, 0 },
         { 0,  0, 0, 0 }
       };
 
@@ -1447,6 +1625,258 @@ cmdline_parser_internal (
                 additional_error))
               goto failure;
           
+          }
+          /* Number of worker threads for the parallel analyses (0 uses all cores).  */
+          else if (strcmp (long_options[option_index].name, "threads") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->threads_arg), 
+                 &(args_info->threads_orig), &(args_info->threads_given),
+                &(local_args_info.threads_given), optarg, 0, "0", ARG_INT,
+                check_ambiguity, override, 0, 0,
+                "threads", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Estimate the betweenness by sampling, within this error of the normalized values.  */
+          else if (strcmp (long_options[option_index].name, "betweenness-epsilon") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->betweenness_epsilon_arg), 
+                 &(args_info->betweenness_epsilon_orig), &(args_info->betweenness_epsilon_given),
+                &(local_args_info.betweenness_epsilon_given), optarg, 0, 0, ARG_FLOAT,
+                check_ambiguity, override, 0, 0,
+                "betweenness-epsilon", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Probability that the sampled betweenness exceeds the error.  */
+          else if (strcmp (long_options[option_index].name, "betweenness-delta") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->betweenness_delta_arg), 
+                 &(args_info->betweenness_delta_orig), &(args_info->betweenness_delta_given),
+                &(local_args_info.betweenness_delta_given), optarg, 0, "0.1", ARG_FLOAT,
+                check_ambiguity, override, 0, 0,
+                "betweenness-delta", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Estimate the betweenness by sampling for this many seconds.  */
+          else if (strcmp (long_options[option_index].name, "betweenness-time") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->betweenness_time_arg), 
+                 &(args_info->betweenness_time_orig), &(args_info->betweenness_time_given),
+                &(local_args_info.betweenness_time_given), optarg, 0, 0, ARG_FLOAT,
+                check_ambiguity, override, 0, 0,
+                "betweenness-time", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Betweenness of every edge.  */
+          else if (strcmp (long_options[option_index].name, "edge-betweenness-output") == 0)
+          {
+          
+          
+            if (update_arg( 0 , 
+                 0 , &(args_info->edge_betweenness_output_given),
+                &(local_args_info.edge_betweenness_output_given), optarg, 0, 0, ARG_NO,
+                check_ambiguity, override, 0, 0,
+                "edge-betweenness-output", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Save the betweenness progress to this file and resume from it if it exists.  */
+          else if (strcmp (long_options[option_index].name, "betweenness-checkpoint") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->betweenness_checkpoint_arg), 
+                 &(args_info->betweenness_checkpoint_orig), &(args_info->betweenness_checkpoint_given),
+                &(local_args_info.betweenness_checkpoint_given), optarg, 0, 0, ARG_STRING,
+                check_ambiguity, override, 0, 0,
+                "betweenness-checkpoint", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Seconds between two betweenness checkpoints.  */
+          else if (strcmp (long_options[option_index].name, "checkpoint-interval") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->checkpoint_interval_arg), 
+                 &(args_info->checkpoint_interval_orig), &(args_info->checkpoint_interval_given),
+                &(local_args_info.checkpoint_interval_given), optarg, 0, "600", ARG_FLOAT,
+                check_ambiguity, override, 0, 0,
+                "checkpoint-interval", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Only count shortest paths of at most this length, in hops or total weight.  */
+          else if (strcmp (long_options[option_index].name, "betweenness-horizon") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->betweenness_horizon_arg), 
+                 &(args_info->betweenness_horizon_orig), &(args_info->betweenness_horizon_given),
+                &(local_args_info.betweenness_horizon_given), optarg, 0, 0, ARG_FLOAT,
+                check_ambiguity, override, 0, 0,
+                "betweenness-horizon", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Truss number of every edge.  */
+          else if (strcmp (long_options[option_index].name, "truss-output") == 0)
+          {
+          
+          
+            if (update_arg( 0 , 
+                 0 , &(args_info->truss_output_given),
+                &(local_args_info.truss_output_given), optarg, 0, 0, ARG_NO,
+                check_ambiguity, override, 0, 0,
+                "truss-output", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Truss number distribution.  */
+          else if (strcmp (long_options[option_index].name, "truss-dist-output") == 0)
+          {
+          
+          
+            if (update_arg( 0 , 
+                 0 , &(args_info->truss_dist_output_given),
+                &(local_args_info.truss_dist_output_given), optarg, 0, 0, ARG_NO,
+                check_ambiguity, override, 0, 0,
+                "truss-dist-output", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Size of every (k, l)-D-core of a directed graph.  */
+          else if (strcmp (long_options[option_index].name, "dcore-output") == 0)
+          {
+          
+          
+            if (update_arg( 0 , 
+                 0 , &(args_info->dcore_output_given),
+                &(local_args_info.dcore_output_given), optarg, 0, 0, ARG_NO,
+                check_ambiguity, override, 0, 0,
+                "dcore-output", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Estimate the clustering coefficients by sampling wedges, within this error.  */
+          else if (strcmp (long_options[option_index].name, "clustering-epsilon") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->clustering_epsilon_arg), 
+                 &(args_info->clustering_epsilon_orig), &(args_info->clustering_epsilon_given),
+                &(local_args_info.clustering_epsilon_given), optarg, 0, 0, ARG_FLOAT,
+                check_ambiguity, override, 0, 0,
+                "clustering-epsilon", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Probability that the sampled clustering coefficients exceed the error.  */
+          else if (strcmp (long_options[option_index].name, "clustering-delta") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->clustering_delta_arg), 
+                 &(args_info->clustering_delta_orig), &(args_info->clustering_delta_given),
+                &(local_args_info.clustering_delta_given), optarg, 0, "0.1", ARG_FLOAT,
+                check_ambiguity, override, 0, 0,
+                "clustering-delta", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Estimate the clustering coefficients from this many sampled wedges each.  */
+          else if (strcmp (long_options[option_index].name, "clustering-samples") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->clustering_samples_arg), 
+                 &(args_info->clustering_samples_orig), &(args_info->clustering_samples_given),
+                &(local_args_info.clustering_samples_given), optarg, 0, 0, ARG_INT,
+                check_ambiguity, override, 0, 0,
+                "clustering-samples", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Closeness of every vertex, by hop count.  */
+          else if (strcmp (long_options[option_index].name, "closeness-output") == 0)
+          {
+          
+          
+            if (update_arg( 0 , 
+                 0 , &(args_info->closeness_output_given),
+                &(local_args_info.closeness_output_given), optarg, 0, 0, ARG_NO,
+                check_ambiguity, override, 0, 0,
+                "closeness-output", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Number of ordered pairs of vertices at every distance, by hop count.  */
+          else if (strcmp (long_options[option_index].name, "distance-output") == 0)
+          {
+          
+          
+            if (update_arg( 0 , 
+                 0 , &(args_info->distance_output_given),
+                &(local_args_info.distance_output_given), optarg, 0, 0, ARG_NO,
+                check_ambiguity, override, 0, 0,
+                "distance-output", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Transitivity and average clustering coefficient, with the error of sampled estimates.  */
+          else if (strcmp (long_options[option_index].name, "clustering-summary-output") == 0)
+          {
+          
+          
+            if (update_arg( 0 , 
+                 0 , &(args_info->clustering_summary_output_given),
+                &(local_args_info.clustering_summary_output_given), optarg, 0, 0, ARG_NO,
+                check_ambiguity, override, 0, 0,
+                "clustering-summary-output", '-',
+                additional_error))
+              goto failure;
+          
+          }
+          /* Definition of the weighted clustering coefficient: barrat or onnela.  */
+          else if (strcmp (long_options[option_index].name, "weighted-clustering") == 0)
+          {
+          
+          
+            if (update_arg( (void *)&(args_info->weighted_clustering_arg), 
+                 &(args_info->weighted_clustering_orig), &(args_info->weighted_clustering_given),
+                &(local_args_info.weighted_clustering_given), optarg, 0, "barrat", ARG_STRING,
+                check_ambiguity, override, 0, 0,
+                "weighted-clustering", '-',
+                additional_error))
+              goto failure;
+          
           }
           
           break;
@@ -0,0 +1,262 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "CompactGraph.h"
+#include "GraphExceptions.h"
+#include "IBetweenness.h"
+#include "ParallelFor.h"
+#include "mili/mili.h"
+
+namespace graphpp
+{
+/**
+ * Class: ApproximateBetweenness
+ * -----------------------------
+ * Description: Estimates the betweenness of every vertex of an undirected graph by sampling
+ * shortest paths (Riondato & Kornaropoulos, "Fast approximation of betweenness centrality
+ * through sampling", 2016). Each sample picks a random pair of distinct vertices and one of
+ * their shortest paths uniformly at random, and credits the inner vertices of the path.
+ * With r = (c / epsilon^2) (floor(log2(VD - 2)) + 1 + ln(1 / delta)) samples, where VD bounds
+ * the number of vertices of a shortest path, every estimate is within epsilon of the
+ * normalized betweenness with probability at least 1 - delta.
+ * Estimates are scaled by n(n - 1) so they are comparable with the exact Betweenness values.
+ * Alternatively, a time budget makes it sample until time runs out; epsilon() then reports
+ * the guarantee achieved by the samples taken.
+ */
+template <class Graph, class Vertex>
+class ApproximateBetweenness : public IBetweenness<Graph, Vertex>
+{
+public:
+    typedef typename IBetweenness<Graph, Vertex>::BetweennessContainer BetweennessContainer;
+    typedef typename IBetweenness<Graph, Vertex>::BetweennessIterator BetweennessIterator;
+    typedef typename CompactGraph<Graph, Vertex>::Index Index;
+
+    /**
+     * @param g Undirected graph to analyze
+     * @param epsilon Maximum additive error of the normalized estimates, 0 for none
+     * @param delta Probability of exceeding epsilon
+     * @param seconds Time budget in seconds, 0 for none. At least one of epsilon and seconds
+     * must be positive, otherwise UnboundedSampling is thrown
+     * @param threads Number of threads, 0 meaning one per available core
+     * @param seed Seed of the sampling; the result does not depend on the number of threads
+     */
+    ApproximateBetweenness(
+        Graph& g,
+        double epsilon,
+        double delta,
+        double seconds = 0.0,
+        unsigned int threads = 0,
+        unsigned long seed = 1)
+        : sampleCount(0), achievedEpsilon(0.0)
+    {
+        if (epsilon <= 0.0 && seconds <= 0.0)
+            throw UnboundedSampling();
+
+        CompactGraph<Graph, Vertex> compact(g);
+        const Index n = compact.verticesCount();
+        std::vector<double> values(n, 0.0);
+
+        const double logTerm = std::floor(std::log2(std::max(vertexDiameter(compact), 3u) - 2.0));
+        const double bound = C * (logTerm + 1.0 + std::log(1.0 / delta));
+        std::size_t limit = std::numeric_limits<std::size_t>::max();
+        if (epsilon > 0.0)
+            limit = std::ceil(bound / (epsilon * epsilon));
+
+        if (n >= 2)
+            values = sample(compact, limit, seconds, threads, seed);
+
+        achievedEpsilon = sampleCount == 0 ? 1.0 : std::sqrt(bound / sampleCount);
+        for (Index i = 0; i < n; ++i)
+        {
+            const double scale = sampleCount == 0 ? 0.0 : double(n) * (n - 1) / sampleCount;
+            betweenness[compact.vertex(i)->getVertexId()] = values[i] * scale;
+        }
+    }
+
+    virtual BetweennessIterator iterator()
+    {
+        return BetweennessIterator(betweenness);
+    }
+
+    // Number of shortest paths sampled
+    std::size_t samples() const
+    {
+        return sampleCount;
+    }
+
+    // Additive error of the normalized estimates guaranteed with probability 1 - delta
+    double epsilon() const
+    {
+        return achievedEpsilon;
+    }
+
+private:
+    // Constant of the sample size bound, as suggested by the authors
+    static constexpr double C = 0.5;
+
+    // Per-thread state for sampling one shortest path
+    struct Sampler
+    {
+        Sampler(const CompactGraph<Graph, Vertex>& graph)
+            : graph(graph),
+              sigma(graph.verticesCount(), 0.0),
+              distance(graph.verticesCount(), -1),
+              hits(graph.verticesCount(), 0.0)
+        {
+        }
+
+        void run(std::size_t sample, unsigned long seed)
+        {
+            const Index n = graph.verticesCount();
+            rng.seed(seed + sample * 0x9E3779B97F4A7C15ULL);
+            const Index s = std::uniform_int_distribution<Index>(0, n - 1)(rng);
+            Index t = std::uniform_int_distribution<Index>(0, n - 2)(rng);
+            if (t >= s)
+                ++t;
+
+            // BFS from s, stopping once every vertex at the distance of t has its path count.
+            sigma[s] = 1.0;
+            distance[s] = 0;
+            order.push_back(s);
+            for (std::size_t head = 0; head < order.size(); ++head)
+            {
+                const Index v = order[head];
+                if (distance[t] >= 0 && distance[v] >= distance[t])
+                    break;
+                for (const Index* w = graph.neighborsBegin(v); w != graph.neighborsEnd(v); ++w)
+                {
+                    if (distance[*w] < 0)
+                    {
+                        distance[*w] = distance[v] + 1;
+                        order.push_back(*w);
+                    }
+                    if (distance[*w] == distance[v] + 1)
+                        sigma[*w] += sigma[v];
+                }
+            }
+
+            // Walk back from t, picking each predecessor with probability sigma[p] / sigma[w].
+            Index w = t;
+            while (distance[t] > 0 && distance[w] > 1)
+            {
+                double pick = std::uniform_real_distribution<double>(0.0, sigma[w])(rng);
+                const Index* p = graph.neighborsBegin(w);
+                Index chosen = *p;
+                for (; p != graph.neighborsEnd(w); ++p)
+                {
+                    if (distance[*p] != distance[w] - 1)
+                        continue;
+                    chosen = *p;
+                    pick -= sigma[*p];
+                    if (pick < 0.0)
+                        break;
+                }
+                hits[chosen] += 1.0;
+                w = chosen;
+            }
+
+            for (const Index v : order)
+            {
+                sigma[v] = 0.0;
+                distance[v] = -1;
+            }
+            order.clear();
+        }
+
+        const CompactGraph<Graph, Vertex>& graph;
+        std::vector<double> sigma;
+        std::vector<int> distance;
+        std::vector<Index> order;
+        std::vector<double> hits;
+        std::mt19937_64 rng;
+    };
+
+    std::vector<double> sample(
+        const CompactGraph<Graph, Vertex>& compact,
+        std::size_t limit,
+        double seconds,
+        unsigned int threads,
+        unsigned long seed)
+    {
+        typedef std::chrono::steady_clock Clock;
+        const Clock::time_point deadline =
+            Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                               std::chrono::duration<double>(seconds));
+        const unsigned int workers = ParallelFor::threadCount(threads);
+        std::vector<std::unique_ptr<Sampler>> samplers(workers);
+        std::atomic<std::size_t> next(0);
+        std::atomic<std::size_t> taken(0);
+
+        // Samples are numbered and each one seeds its own generator, so with an error bound
+        // alone the estimates do not depend on the number of threads.
+        ParallelFor::run(workers, workers, [&](unsigned int thread, std::size_t) {
+            if (!samplers[thread])
+                samplers[thread].reset(new Sampler(compact));
+            std::size_t i;
+            while ((i = next++) < limit)
+            {
+                if (seconds > 0.0 && Clock::now() >= deadline)
+                    break;
+                samplers[thread]->run(i, seed);
+                ++taken;
+            }
+        });
+
+        sampleCount = taken;
+        std::vector<double> values(compact.verticesCount(), 0.0);
+        for (const auto& sampler : samplers)
+            if (sampler)
+                for (Index v = 0; v < values.size(); ++v)
+                    values[v] += sampler->hits[v];
+        return values;
+    }
+
+    // Upper bound of the number of vertices in a shortest path: twice the eccentricity of a
+    // vertex of each connected component, plus one.
+    static unsigned int vertexDiameter(const CompactGraph<Graph, Vertex>& compact)
+    {
+        const Index n = compact.verticesCount();
+        std::vector<int> distance(n, -1);
+        std::vector<Index> queue;
+        unsigned int diameter = 0;
+
+        for (Index root = 0; root < n; ++root)
+        {
+            if (distance[root] >= 0)
+                continue;
+            queue.assign(1, root);
+            distance[root] = 0;
+            int eccentricity = 0;
+            for (std::size_t head = 0; head < queue.size(); ++head)
+            {
+                const Index v = queue[head];
+                eccentricity = distance[v];
+                for (const Index* w = compact.neighborsBegin(v); w != compact.neighborsEnd(v); ++w)
+                {
+                    if (distance[*w] < 0)
+                    {
+                        distance[*w] = distance[v] + 1;
+                        queue.push_back(*w);
+                    }
+                }
+            }
+            diameter = std::max(diameter, 2u * eccentricity + 1);
+        }
+        return diameter;
+    }
+
+    std::size_t sampleCount;
+    double achievedEpsilon;
+    BetweennessContainer betweenness;
+};
+
+template <class Graph, class Vertex>
+constexpr double ApproximateBetweenness<Graph, Vertex>::C;
+}  // namespace graphpp
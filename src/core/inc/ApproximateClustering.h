@@ -0,0 +1,374 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "Boxplotentry.h"
+#include "ClusteringCoefficient.h"
+#include "CompactGraph.h"
+#include "GraphExceptions.h"
+#include "IClusteringCoefficient.h"
+#include "ParallelFor.h"
+
+namespace graphpp
+{
+/**
+ * Class: ApproximateClusteringCoefficient
+ * ---------------------------------------
+ * Description: Estimates the clustering of an undirected graph by sampling wedges, pairs of
+ * distinct neighbors of a vertex, and checking whether they are joined by an edge (Seshadhri,
+ * Pinar and Kolda, "Wedge sampling for computing clustering coefficients and triangle counts
+ * on large graphs", 2014). The fraction of closed wedges among
+ * - wedges drawn uniformly from the whole graph estimates the global transitivity;
+ * - wedges of uniformly drawn vertices estimates the average clustering coefficient;
+ * - wedges of uniformly drawn vertices of degree k estimates C(k).
+ * By Hoeffding's inequality, r = ln(2 / delta) / (2 epsilon^2) samples put each of these
+ * estimates within epsilon of the exact value with probability at least 1 - delta, whatever
+ * the size of the graph. Alternatively, a sample budget fixes r; epsilon() then reports the
+ * guarantee it gives. Vertices and groups of vertices with at most r wedges are computed
+ * exactly instead. Parallel edges count once and loops are ignored, as in
+ * ClusteringCoefficient.
+ */
+template <class Graph, class Vertex>
+class ApproximateClusteringCoefficient : public IClusteringCoefficient<Graph, Vertex>
+{
+public:
+    typedef typename CompactGraph<Graph, Vertex>::Index Index;
+
+    // A value with its additive error: epsilon() when sampled, 0 when computed exactly.
+    struct Estimate
+    {
+        double value;
+        double error;
+    };
+
+    /**
+     * @param epsilon Maximum additive error of every estimate, 0 for none
+     * @param delta Probability of exceeding epsilon
+     * @param samples Number of wedges sampled per estimate, 0 for none. At least one of
+     * epsilon and samples must be positive, otherwise UnboundedSampling is thrown; with both,
+     * the smaller number of samples is taken
+     * @param seed Seed of the sampling; the estimates do not depend on the number of threads
+     */
+    ApproximateClusteringCoefficient(
+        double epsilon, double delta, std::size_t samples = 0, unsigned long seed = 1)
+        : logTerm(std::log(2.0 / delta)), sampleCount(samples), seed(seed)
+    {
+        if (epsilon <= 0.0 && samples == 0)
+            throw UnboundedSampling();
+        if (epsilon > 0.0)
+        {
+            const std::size_t bound = std::ceil(logTerm / (2.0 * epsilon * epsilon));
+            sampleCount = samples == 0 ? bound : std::min(samples, bound);
+        }
+    }
+
+    // Number of wedges sampled per estimate
+    std::size_t samples() const
+    {
+        return sampleCount;
+    }
+
+    // Additive error of every estimate guaranteed with probability 1 - delta
+    double epsilon() const
+    {
+        return std::sqrt(logTerm / (2.0 * sampleCount));
+    }
+
+    virtual double clusteringCoefficient(Graph& g, unsigned int d)
+    {
+        const Neighborhoods hoods(g);
+        std::vector<Index> group;
+        for (Index v = 0; v < hoods.compact.verticesCount(); ++v)
+        {
+            if (hoods.compact.vertex(v)->degree() == d)
+                group.push_back(v);
+        }
+        const Estimate estimate = groupEstimate(
+            hoods, group.size(), [&group](std::size_t i) { return group[i]; }, DEGREE, d, 1);
+        return estimate.value;
+    }
+
+    virtual double vertexClusteringCoefficient(Vertex* vertex)
+    {
+        std::vector<Vertex*> neighbors;
+        auto it = vertex->neighborsIterator();
+        for (; !it.end(); ++it)
+        {
+            if (*it != vertex)
+                neighbors.push_back(static_cast<Vertex*>(*it));
+        }
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+        const std::size_t k = neighbors.size();
+        if (k * (k - 1) / 2 <= sampleCount)
+            return ClusteringCoefficient<Graph, Vertex>().vertexClusteringCoefficient(vertex);
+
+        std::mt19937_64 random = generator(VERTEX, vertex->getVertexId(), 0);
+        std::size_t closed = 0;
+        for (std::size_t s = 0; s < sampleCount; ++s)
+        {
+            const std::pair<std::size_t, std::size_t> wedge = drawWedge(k, random);
+            closed += neighbors[wedge.first]->isNeighbourOf(neighbors[wedge.second]);
+        }
+        return double(closed) / sampleCount;
+    }
+
+    virtual std::vector<double> vertexClusteringCoefficients(Graph& g, unsigned int threads = 0)
+    {
+        const Neighborhoods hoods(g);
+        std::vector<double> values(hoods.compact.verticesCount(), 0.0);
+        ParallelFor::run(
+            values.size(),
+            threads,
+            [&](unsigned int, std::size_t v) {
+                const Index one = v;
+                const Estimate estimate = groupEstimate(
+                    hoods, 1, [one](std::size_t) { return one; }, VERTEX,
+                    hoods.compact.vertex(one)->getVertexId(), 1);
+                values[v] = estimate.value;
+            },
+            64);
+        return values;
+    }
+
+    /*
+     * C(k) from one snapshot of g, estimating every degree on its own samples. The groups are
+     * spread among the threads. The per-vertex values of a degree are not known, so its entry
+     * holds the estimate once for every vertex of that degree.
+     */
+    virtual std::vector<Boxplotentry> clusteringCoefficientByDegree(
+        Graph& g, unsigned int threads = 0)
+    {
+        const Neighborhoods hoods(g);
+        std::map<unsigned int, std::vector<Index>> groups;
+        for (Index v = 0; v < hoods.compact.verticesCount(); ++v)
+            groups[hoods.compact.vertex(v)->degree()].push_back(v);
+
+        std::vector<const std::pair<const unsigned int, std::vector<Index>>*> order;
+        for (const auto& group : groups)
+            order.push_back(&group);
+        std::vector<Boxplotentry> entries(order.size());
+        ParallelFor::run(order.size(), threads, [&](unsigned int, std::size_t i) {
+            const std::vector<Index>& group = order[i]->second;
+            const Estimate estimate = groupEstimate(
+                hoods, group.size(), [&group](std::size_t j) { return group[j]; }, DEGREE,
+                order[i]->first, 1);
+            entries[i] = Boxplotentry::summarize(
+                order[i]->first, std::vector<double>(group.size(), estimate.value));
+        });
+        return entries;
+    }
+
+    virtual double averageClusteringCoefficient(Graph& g, unsigned int threads = 0)
+    {
+        return averageClusteringEstimate(g, threads).value;
+    }
+
+    virtual double transitivity(Graph& g, unsigned int threads = 0)
+    {
+        return transitivityEstimate(g, threads).value;
+    }
+
+    // averageClusteringCoefficient with its error.
+    Estimate averageClusteringEstimate(Graph& g, unsigned int threads = 0)
+    {
+        const Neighborhoods hoods(g);
+        return groupEstimate(
+            hoods, hoods.compact.verticesCount(), [](std::size_t i) { return Index(i); },
+            AVERAGE, 0, threads);
+    }
+
+    // transitivity with its error.
+    Estimate transitivityEstimate(Graph& g, unsigned int threads = 0)
+    {
+        const Neighborhoods hoods(g);
+        const Index n = hoods.compact.verticesCount();
+        std::vector<std::uint64_t> wedges(n + 1, 0);
+        for (Index v = 0; v < n; ++v)
+            wedges[v + 1] = wedges[v] + hoods.wedges(v);
+        if (wedges[n] == 0)
+            return Estimate{0.0, 0.0};
+
+        if (wedges[n] <= sampleCount)
+        {
+            double closed = 0.0;
+            for (Index v = 0; v < n; ++v)
+                closed += hoods.clustering(v) * hoods.wedges(v);
+            return Estimate{closed / wedges[n], 0.0};
+        }
+
+        // The center of a uniform wedge is a vertex drawn with probability proportional to
+        // its wedges.
+        const double value = fraction(TRANSITIVITY, 0, threads, [&](std::mt19937_64& random) {
+            const std::uint64_t w =
+                std::uniform_int_distribution<std::uint64_t>(0, wedges[n] - 1)(random);
+            const Index v = std::upper_bound(wedges.begin(), wedges.end(), w) - wedges.begin() - 1;
+            return hoods.sample(v, random);
+        });
+        return Estimate{value, epsilon()};
+    }
+
+private:
+    // Independent random streams of the estimates.
+    enum Stream
+    {
+        VERTEX,
+        DEGREE,
+        AVERAGE,
+        TRANSITIVITY
+    };
+
+    // Number of samples drawn from one generator, seeded by its position, so the estimates
+    // do not depend on how the blocks are spread among the threads.
+    static const std::size_t BLOCK = 4096;
+
+    // Distinct neighbors of every vertex other than itself, sorted by index.
+    struct Neighborhoods
+    {
+        explicit Neighborhoods(Graph& g) : compact(g)
+        {
+            const Index n = compact.verticesCount();
+            offsets.reserve(n + 1);
+            offsets.push_back(0);
+            for (Index v = 0; v < n; ++v)
+            {
+                for (const Index* w = compact.neighborsBegin(v); w != compact.neighborsEnd(v); ++w)
+                {
+                    if (*w != v && (targets.size() == offsets.back() || targets.back() != *w))
+                        targets.push_back(*w);
+                }
+                offsets.push_back(targets.size());
+            }
+        }
+
+        std::size_t degree(Index v) const
+        {
+            return offsets[v + 1] - offsets[v];
+        }
+
+        std::uint64_t wedges(Index v) const
+        {
+            const std::uint64_t k = degree(v);
+            return k < 2 ? 0 : k * (k - 1) / 2;
+        }
+
+        // Whether the i-th and j-th neighbors of v are adjacent.
+        bool closed(Index v, std::size_t i, std::size_t j) const
+        {
+            Index a = targets[offsets[v] + i];
+            Index b = targets[offsets[v] + j];
+            if (degree(a) > degree(b))
+                std::swap(a, b);
+            return std::binary_search(
+                targets.begin() + offsets[a], targets.begin() + offsets[a + 1], b);
+        }
+
+        // Whether a uniformly drawn wedge of v is closed, false if v has no wedges.
+        bool sample(Index v, std::mt19937_64& random) const
+        {
+            if (degree(v) < 2)
+                return false;
+            const std::pair<std::size_t, std::size_t> wedge = drawWedge(degree(v), random);
+            return closed(v, wedge.first, wedge.second);
+        }
+
+        // Exact clustering coefficient of v, checking each of its wedges.
+        double clustering(Index v) const
+        {
+            const std::size_t k = degree(v);
+            if (k < 2)
+                return 0.0;
+            std::size_t links = 0;
+            for (std::size_t i = 0; i < k; ++i)
+            {
+                for (std::size_t j = i + 1; j < k; ++j)
+                    links += closed(v, i, j);
+            }
+            return double(links) / wedges(v);
+        }
+
+        CompactGraph<Graph, Vertex> compact;
+        std::vector<std::size_t> offsets;
+        std::vector<Index> targets;
+    };
+
+    // Positions of two distinct neighbors out of k, drawn uniformly.
+    static std::pair<std::size_t, std::size_t> drawWedge(std::size_t k, std::mt19937_64& random)
+    {
+        const std::size_t i = std::uniform_int_distribution<std::size_t>(0, k - 1)(random);
+        std::size_t j = std::uniform_int_distribution<std::size_t>(0, k - 2)(random);
+        if (j >= i)
+            ++j;
+        return std::make_pair(i, j);
+    }
+
+    std::mt19937_64 generator(Stream stream, std::uint64_t key, std::size_t block) const
+    {
+        std::seed_seq sequence{std::uint32_t(seed), std::uint32_t(stream), std::uint32_t(key),
+                               std::uint32_t(key >> 32), std::uint32_t(block)};
+        return std::mt19937_64(sequence);
+    }
+
+    // Fraction of samples() draws that return true, drawn in blocks on the given threads.
+    template <class Draw>
+    double fraction(Stream stream, std::uint64_t key, unsigned int threads, Draw draw) const
+    {
+        const std::size_t blocks = (sampleCount + BLOCK - 1) / BLOCK;
+        std::vector<std::size_t> hits(blocks, 0);
+        ParallelFor::run(blocks, threads, [&](unsigned int, std::size_t b) {
+            std::mt19937_64 random = generator(stream, key, b);
+            const std::size_t end = std::min(sampleCount, (b + 1) * BLOCK);
+            for (std::size_t s = b * BLOCK; s < end; ++s)
+                hits[b] += draw(random);
+        });
+        std::size_t total = 0;
+        for (const std::size_t h : hits)
+            total += h;
+        return double(total) / sampleCount;
+    }
+
+    /*
+     * Mean clustering coefficient of the size vertices member(0), member(1)...: exact when
+     * they have at most samples() wedges in all, and otherwise the fraction of closed wedges
+     * among samples() wedges of uniformly drawn members.
+     */
+    template <class Member>
+    Estimate groupEstimate(
+        const Neighborhoods& hoods,
+        std::size_t size,
+        Member member,
+        Stream stream,
+        std::uint64_t key,
+        unsigned int threads) const
+    {
+        if (size == 0)
+            return Estimate{0.0, 0.0};
+
+        std::uint64_t wedges = 0;
+        for (std::size_t i = 0; i < size && wedges <= sampleCount; ++i)
+            wedges += hoods.wedges(member(i));
+        if (wedges <= sampleCount)
+        {
+            double sum = 0.0;
+            for (std::size_t i = 0; i < size; ++i)
+                sum += hoods.clustering(member(i));
+            return Estimate{sum / size, 0.0};
+        }
+
+        const double value = fraction(stream, key, threads, [&](std::mt19937_64& random) {
+            const std::size_t i = std::uniform_int_distribution<std::size_t>(0, size - 1)(random);
+            return hoods.sample(member(i), random);
+        });
+        return Estimate{value, epsilon()};
+    }
+
+    double logTerm;
+    std::size_t sampleCount;
+    unsigned long seed;
+};
+}  // namespace graphpp
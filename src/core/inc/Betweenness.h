@@ -1,10 +1,10 @@
 #pragma once
 
-#include <list>
-#include <queue>
-#include <stack>
 #include <vector>
 
+#include "BiconnectedComponents.h"
+#include "BrandesKernel.h"
+#include "CompactGraph.h"
 #include "IBetweenness.h"
 #include "mili/mili.h"
 
@@ -17,10 +17,21 @@ public:
     typedef typename IBetweenness<Graph, Vertex>::BetweennessContainer BetweennessContainer;
     typedef typename IBetweenness<Graph, Vertex>::BetweennessIterator BetweennessIterator;
 
-    Betweenness(Graph& g)
+    /**
+     * Computes the betweenness of every vertex of g. The sources of the shortest path
+     * trees are distributed among the given number of threads (0 uses one per core);
+     * each thread accumulates into its own container and they are added at the end.
+     * Undirected graphs are split into biconnected blocks first (see biconnectedBetweenness).
+     */
+    Betweenness(Graph& g, unsigned int threads = 0)
     {
-        initMap(g, (*g.verticesIterator())->getVertexId(), betweenness, 0.0, 0.0);
-        calculateBetweenness(g);
+        CompactGraph<Graph, Vertex> compact(g);
+        const std::vector<double> values = g.isDigraph()
+                                               ? unweightedBetweenness(compact, threads)
+                                               : biconnectedBetweenness(compact, threads);
+
+        for (unsigned int i = 0; i < compact.verticesCount(); ++i)
+            betweenness[compact.vertex(i)->getVertexId()] = values[i];
     }
 
     virtual BetweennessIterator iterator()
@@ -29,101 +40,6 @@ public:
     }
 
 private:
-    void calculateBetweenness(Graph& g)
-    {
-        auto iter = g.verticesIterator();
-
-        while (!iter.end())
-        {
-            Vertex* s = *iter;
-            std::stack<Vertex*> stack;
-            std::queue<Vertex*> queue;
-            std::map<typename Vertex::VertexId, std::list<typename Vertex::VertexId>> p;
-            std::map<typename Vertex::VertexId, double> sigma;
-            std::map<typename Vertex::VertexId, double> d;
-            std::map<typename Vertex::VertexId, double> delta;
-
-            initMap(g, s->getVertexId(), sigma, 0.0, 1.0);
-            initMap(g, s->getVertexId(), d, -1.0, 0.0);
-            initMap(g, s->getVertexId(), delta, 0.0, 0.0);
-
-            queue.push(s);
-
-            while (!queue.empty())
-            {
-                Vertex* v = queue.front();
-                queue.pop();
-                stack.push(v);
-
-                // iterate through v's neighbors
-                auto neighbourIter = v->neighborsIterator();
-
-                while (!neighbourIter.end())
-                {
-                    Vertex* w = *neighbourIter;
-                    // w found for the first time?
-                    double wValue = d[w->getVertexId()];
-                    // double vValue = d[v->getVertexId()];
-                    if (wValue < 0)
-                    {
-                        queue.push(w);
-                        d[w->getVertexId()] = d[v->getVertexId()] + 1;
-                    }
-                    // shortest path to w via v?
-                    if (d[w->getVertexId()] == (d[v->getVertexId()] + 1))
-                    {
-                        sigma[w->getVertexId()] = sigma[w->getVertexId()] + sigma[v->getVertexId()];
-                        p[w->getVertexId()].push_back(v->getVertexId());
-                    }
-
-                    ++neighbourIter;
-                }
-            }
-
-            // S returns vertices in order of non-increasing distance from s
-            while (!stack.empty())
-            {
-                Vertex* w = stack.top();
-                stack.pop();
-
-                std::list<typename Vertex::VertexId> vertices = p[w->getVertexId()];
-
-                for (const auto& v : vertices)
-                {
-                    delta[v] = delta[v] + ((1 + delta[w->getVertexId()]) *
-                                           (sigma[v] / sigma[w->getVertexId()]));
-                }
-
-                if (w->getVertexId() != s->getVertexId())
-                {
-                    betweenness[w->getVertexId()] += delta[w->getVertexId()];
-                }
-            }
-
-            ++iter;
-        }
-    }
-
-    void initMap(
-        Graph& g,
-        unsigned int vertexId,
-        std::map<typename Vertex::VertexId, double>& m,
-        double commonValue,
-        double distinguishedValue)
-    {
-        auto it = g.verticesIterator();
-
-        // initialize all elements in zero, except for the current vertex
-        while (!it.end())
-        {
-            Vertex* v = *it;
-            m.insert(std::pair<typename Vertex::VertexId, double>(v->getVertexId(), commonValue));
-            ++it;
-        }
-        // modify the value associated to key 'vertexId'
-        m[vertexId] = distinguishedValue;
-    }
-
     BetweennessContainer betweenness;
 };
 }  // namespace graphpp
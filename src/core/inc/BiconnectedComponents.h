@@ -0,0 +1,218 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "BrandesKernel.h"
+
+namespace graphpp
+{
+/**
+ * Class: BiconnectedComponents
+ * ----------------------------
+ * Description: Blocks (maximal biconnected subgraphs, bridges included) of an undirected
+ * CompactGraph, found with an iterative Hopcroft-Tarjan search. Two blocks share at most one
+ * vertex, an articulation point, and every path leaving a block goes through one of them.
+ * Each vertex v of a block B stands for the vertices that can only be reached from B through
+ * v, itself included; these reach counts add up to the size of the connected component of B.
+ * Parallel edges are kept apart, so a doubled edge is a block of its own, and self loops are
+ * ignored.
+ */
+template <class Compact>
+class BiconnectedComponents
+{
+public:
+    typedef typename Compact::Index Index;
+
+    explicit BiconnectedComponents(const Compact& graph)
+        : components(graph.verticesCount(), 0)
+    {
+        const Index n = graph.verticesCount();
+        std::vector<Index> discovery(n, NONE);
+        std::vector<Index> low(n);
+        std::vector<Index> size(n, 1);
+        std::vector<Index> hanging(n, 0);
+        std::vector<Index> visited;
+        std::vector<Frame> stack;
+        Index time = 0;
+
+        for (Index root = 0; root < n; ++root)
+        {
+            if (discovery[root] != NONE)
+                continue;
+            const std::size_t firstBlock = blocks.size();
+            discovery[root] = low[root] = time++;
+            visited.push_back(root);
+            stack.push_back(Frame{root, graph.offset(root), graph.slotsCount()});
+
+            while (!stack.empty())
+            {
+                Frame& frame = stack.back();
+                const Index v = frame.vertex;
+                if (frame.next < graph.offset(v + 1))
+                {
+                    const std::size_t e = frame.next++;
+                    const Index w = graph.target(e);
+                    if (w == v || e == frame.reverse)
+                        continue;
+                    if (discovery[w] == NONE)
+                    {
+                        discovery[w] = low[w] = time++;
+                        visited.push_back(w);
+                        stack.push_back(Frame{w, graph.offset(w), graph.twin(v, e)});
+                    }
+                    else
+                        low[v] = std::min(low[v], discovery[w]);
+                    continue;
+                }
+
+                stack.pop_back();
+                if (stack.empty())
+                    break;
+                const Index parent = stack.back().vertex;
+                low[parent] = std::min(low[parent], low[v]);
+                size[parent] += size[v];
+                if (low[v] < discovery[parent])
+                    continue;
+
+                // The subtree of v, minus the blocks already split off it, closes a block
+                // with parent; the rest of the component is reached from it through parent.
+                Block block;
+                Index member;
+                do
+                {
+                    member = visited.back();
+                    visited.pop_back();
+                    block.vertices.push_back(member);
+                    block.reach.push_back(1.0 + hanging[member]);
+                } while (member != v);
+                block.vertices.push_back(parent);
+                block.reach.push_back(-double(size[v]));
+                hanging[parent] += size[v];
+                blocks.push_back(block);
+            }
+            visited.clear();
+
+            // The component size is only known now; complete the reach of the top vertices.
+            for (std::size_t b = firstBlock; b < blocks.size(); ++b)
+                blocks[b].reach.back() += size[root];
+            for (std::size_t b = firstBlock; b < blocks.size(); ++b)
+                for (const Index v : blocks[b].vertices)
+                    components[v] = size[root];
+            components[root] = size[root];
+        }
+    }
+
+    std::size_t blocksCount() const
+    {
+        return blocks.size();
+    }
+
+    // Vertices of a block, in no particular order.
+    const std::vector<Index>& vertices(std::size_t block) const
+    {
+        return blocks[block].vertices;
+    }
+
+    // Reach of the vertices of a block, aligned with vertices(block).
+    const std::vector<double>& reach(std::size_t block) const
+    {
+        return blocks[block].reach;
+    }
+
+    // Number of vertices in the connected component of v.
+    Index componentSize(Index v) const
+    {
+        return components[v];
+    }
+
+private:
+    static const Index NONE = std::numeric_limits<Index>::max();
+
+    struct Frame
+    {
+        Index vertex;
+        std::size_t next;
+        // Slot leading back to the parent, which is not a back edge.
+        std::size_t reverse;
+    };
+
+    struct Block
+    {
+        std::vector<Index> vertices;
+        std::vector<double> reach;
+    };
+
+    std::vector<Block> blocks;
+    std::vector<Index> components;
+};
+
+template <class Compact>
+const typename Compact::Index BiconnectedComponents<Compact>::NONE;
+
+/**
+ * Function: biconnectedBetweenness
+ * --------------------------------
+ * Description: Exact betweenness of an undirected graph computed block by block (Puzis et al.,
+ * "Heuristics for speeding up betweenness centrality computation", 2012). Shortest paths
+ * between the vertices of two blocks cross the blocks in between through their articulation
+ * points, so running Brandes inside every block with the reach of its vertices as weights
+ * counts every pair whose path goes through an inner vertex of the block. An articulation point
+ * a also lies on every path between two of its branches, the sides of a that each block holds,
+ * which adds (n_c - 1)^2 - sum over its blocks B of (n_c - reach_B(a))^2 for a component of n_c
+ * vertices. Blocks of two vertices, among them the pendant trees of degree one vertices, have
+ * no inner vertices and are not searched at all.
+ * @param graph Undirected graph to analyze
+ * @param threads Number of threads, 0 meaning one per available core
+ * @returns The betweenness of every vertex, indexed by vertex index
+ */
+template <class Compact>
+std::vector<double> biconnectedBetweenness(const Compact& graph, unsigned int threads)
+{
+    typedef typename Compact::Index Index;
+    const BiconnectedComponents<Compact> components(graph);
+    std::vector<double> result(graph.verticesCount(), 0.0);
+    std::vector<double> branches(graph.verticesCount(), 0.0);
+
+    for (std::size_t b = 0; b < components.blocksCount(); ++b)
+    {
+        const std::vector<Index>& vertices = components.vertices(b);
+        const std::vector<double>& reach = components.reach(b);
+        const double component = components.componentSize(vertices.front());
+        for (std::size_t i = 0; i < vertices.size(); ++i)
+            branches[vertices[i]] += (component - reach[i]) * (component - reach[i]);
+        if (vertices.size() < 3)
+            continue;
+
+        std::vector<std::size_t> order(vertices.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+        std::sort(order.begin(), order.end(), [&](std::size_t i, std::size_t j) {
+            return vertices[i] < vertices[j];
+        });
+        std::vector<Index> sorted(order.size());
+        std::vector<double> sortedReach(order.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            sorted[i] = vertices[order[i]];
+            sortedReach[i] = reach[order[i]];
+        }
+
+        const Compact block(graph, sorted);
+        const std::vector<double> values =
+            Compact::weighted
+                ? weightedBetweenness(block, threads, nullptr, nullptr, &sortedReach)
+                : unweightedBetweenness(block, threads, nullptr, nullptr, &sortedReach);
+        for (std::size_t i = 0; i < sorted.size(); ++i)
+            result[sorted[i]] += values[i];
+    }
+
+    for (Index v = 0; v < graph.verticesCount(); ++v)
+    {
+        const double others = components.componentSize(v) - 1.0;
+        result[v] += others * others - branches[v];
+    }
+    return result;
+}
+}  // namespace graphpp
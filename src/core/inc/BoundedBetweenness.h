@@ -0,0 +1,54 @@
+#pragma once
+
+#include <vector>
+
+#include "BrandesKernel.h"
+#include "CompactGraph.h"
+#include "IBetweenness.h"
+#include "mili/mili.h"
+
+namespace graphpp
+{
+/**
+ * Class: BoundedBetweenness
+ * -------------------------
+ * Description: Length-limited betweenness: only the shortest paths between vertices at most
+ * k apart are counted. Every search from a source stops at depth k (or distance k, taking
+ * the edge weights as lengths in weighted graphs), so the work per source is the size of its
+ * k-neighborhood instead of the whole graph, which for small k on small-world graphs is a
+ * small fraction of it. Directed graphs follow the edges in their direction.
+ * With k at least the diameter the result is the plain betweenness.
+ */
+template <class Graph, class Vertex>
+class BoundedBetweenness : public IBetweenness<Graph, Vertex>
+{
+public:
+    typedef typename IBetweenness<Graph, Vertex>::BetweennessContainer BetweennessContainer;
+    typedef typename IBetweenness<Graph, Vertex>::BetweennessIterator BetweennessIterator;
+
+    /**
+     * @param g Graph to analyze
+     * @param k Largest length (hops, or sum of weights) of the paths counted
+     * @param threads Number of threads, 0 meaning one per available core
+     */
+    BoundedBetweenness(Graph& g, double k, unsigned int threads = 0)
+    {
+        typedef CompactGraph<Graph, Vertex> Compact;
+        const Compact compact(g);
+        const std::vector<double> values =
+            Compact::weighted
+                ? weightedBetweenness(compact, threads, nullptr, nullptr, nullptr, k)
+                : unweightedBetweenness(compact, threads, nullptr, nullptr, nullptr, k);
+        for (typename Compact::Index i = 0; i < compact.verticesCount(); ++i)
+            betweenness[compact.vertex(i)->getVertexId()] = values[i];
+    }
+
+    virtual BetweennessIterator iterator()
+    {
+        return BetweennessIterator(betweenness);
+    }
+
+private:
+    BetweennessContainer betweenness;
+};
+}  // namespace graphpp
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace graphpp
@@ -17,6 +22,36 @@ public:
     unsigned int bin;
     std::vector<double> values;
 
+    /**
+     * Method: summarize
+     * -----------------
+     * Description: Entry for a group of values: their mean, in the given order, extremes and
+     * quartiles, and the values themselves, sorted. An empty group gives an entry with no
+     * values and every statistic 0.
+     */
+    static Boxplotentry summarize(unsigned int degree, std::vector<double> values)
+    {
+        Boxplotentry entry;
+        entry.degree = degree;
+        entry.bin = 0;
+        entry.mean = entry.min = entry.max = entry.Q1 = entry.Q2 = entry.Q3 = 0.0;
+        if (!values.empty())
+        {
+            double sum = 0.0;
+            for (const double value : values)
+                sum += value;
+            entry.mean = sum / values.size();
+            std::sort(values.begin(), values.end());
+            entry.min = values.front();
+            entry.max = values.back();
+            entry.Q1 = values.at(values.size() / 4);
+            entry.Q2 = values.at(values.size() / 2);
+            entry.Q3 = values.at(std::size_t(values.size() * 0.75));
+        }
+        entry.values = std::move(values);
+        return entry;
+    }
+
     // define the operator to order vectors properly
     bool operator<(const Boxplotentry& other) const
     {
@@ -37,4 +72,29 @@ public:
         return ss.str();
     }
 };
+
+/**
+ * Function: groupByDegree
+ * -----------------------
+ * Description: Splits a value per vertex, such as the clustering coefficient, by vertex degree
+ * in a single sweep over the vertices, and summarizes every group with Boxplotentry::summarize.
+ * @param g Graph the values belong to
+ * @param values Value of every vertex of g, in the order g iterates them
+ * @returns One entry per degree of some vertex of g, sorted by degree; the number of vertices
+ * of that degree is the number of values of the entry
+ */
+template <class Graph>
+std::vector<Boxplotentry> groupByDegree(Graph& g, const std::vector<double>& values)
+{
+    std::map<unsigned int, std::vector<double>> groups;
+    auto it = g.verticesIterator();
+    for (std::size_t i = 0; !it.end(); ++it, ++i)
+        groups[(*it)->degree()].push_back(values[i]);
+
+    std::vector<Boxplotentry> entries;
+    entries.reserve(groups.size());
+    for (auto& group : groups)
+        entries.push_back(Boxplotentry::summarize(group.first, std::move(group.second)));
+    return entries;
+}
 }  // namespace graphpp
@@ -0,0 +1,707 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "BucketQueue.h"
+#include "IndexedHeap.h"
+#include "MultiSourceBFS.h"
+#include "ParallelFor.h"
+
+namespace graphpp
+{
+/**
+ * Class: BrandesAccumulator
+ * -------------------------
+ * Description: Runs a Brandes kernel from batches of Kernel::BATCH sources spread among the
+ * given number of threads. Every thread owns a kernel and accumulators, created the first time
+ * it runs and kept across calls to add, so the sources can be processed in several rounds
+ * without allocating the scratch arrays again; collect adds the accumulators together.
+ * Template Argument Kernel: BrandesKernel, MultiSourceBrandesKernel or WeightedBrandesKernel
+ */
+template <class Kernel, class Compact>
+class BrandesAccumulator
+{
+public:
+    typedef typename Compact::Index Index;
+
+    /**
+     * @param graph Graph to analyze
+     * @param threads Number of threads, 0 meaning one per available core
+     * @param edges Whether the betweenness of every adjacency slot is accumulated too
+     * @param reach If not null, how many vertices every vertex stands for (see BrandesKernel)
+     * @param horizon Only pairs at most this far apart are counted (see BrandesKernel)
+     */
+    BrandesAccumulator(
+        const Compact& graph,
+        unsigned int threads,
+        bool edges = false,
+        const std::vector<double>* reach = nullptr,
+        double horizon = std::numeric_limits<double>::infinity())
+        : graph(graph),
+          threads(threads),
+          edges(edges),
+          reach(reach),
+          horizon(horizon),
+          kernels(ParallelFor::threadCount(threads)),
+          partial(kernels.size()),
+          partialEdges(kernels.size())
+    {
+    }
+
+    // Adds the dependencies of the given distinct sources.
+    void add(const Index* sources, std::size_t count)
+    {
+        const std::size_t batch = Kernel::BATCH;
+        const std::size_t batches = (count + batch - 1) / batch;
+        ParallelFor::run(batches, threads, [&](unsigned int thread, std::size_t b) {
+            if (!kernels[thread])
+            {
+                kernels[thread].reset(new Kernel(graph, reach, horizon));
+                partial[thread].assign(graph.verticesCount(), 0.0);
+                if (edges)
+                    partialEdges[thread].assign(graph.slotsCount(), 0.0);
+            }
+            const std::size_t first = b * batch;
+            kernels[thread]->accumulate(
+                sources + first,
+                std::min(batch, count - first),
+                partial[thread],
+                edges ? &partialEdges[thread] : nullptr);
+        });
+    }
+
+    /*
+     * Adds what the threads accumulated, in thread order, to the betweenness of every vertex
+     * and, if given, of every slot, and clears the accumulators.
+     */
+    void collect(std::vector<double>& vertices, std::vector<double>* slots = nullptr)
+    {
+        for (auto& accumulator : partial)
+        {
+            for (std::size_t v = 0; v < accumulator.size(); ++v)
+                vertices[v] += accumulator[v];
+            std::fill(accumulator.begin(), accumulator.end(), 0.0);
+        }
+        for (auto& accumulator : partialEdges)
+        {
+            if (slots != nullptr)
+                for (std::size_t e = 0; e < accumulator.size(); ++e)
+                    (*slots)[e] += accumulator[e];
+            std::fill(accumulator.begin(), accumulator.end(), 0.0);
+        }
+    }
+
+private:
+    const Compact& graph;
+    const unsigned int threads;
+    const bool edges;
+    const std::vector<double>* reach;
+    const double horizon;
+    std::vector<std::unique_ptr<Kernel>> kernels;
+    std::vector<std::vector<double>> partial;
+    std::vector<std::vector<double>> partialEdges;
+};
+
+/**
+ * Function: brandesBetweenness
+ * ----------------------------
+ * Description: Runs a Brandes kernel from every vertex of the graph, or from the given ones,
+ * as a single round of a BrandesAccumulator.
+ * Template Argument Kernel: BrandesKernel, MultiSourceBrandesKernel or WeightedBrandesKernel
+ * @param graph Graph to analyze
+ * @param threads Number of threads, 0 meaning one per available core
+ * @param edges If not null, receives the betweenness of every adjacency slot of the graph
+ * @param sources If not null, the distinct sources whose dependencies are added up
+ * @param reach If not null, how many vertices every vertex stands for (see BrandesKernel)
+ * @param horizon Only pairs at most this far apart are counted (see BrandesKernel)
+ * @returns The betweenness of every vertex, indexed by vertex index
+ */
+template <class Kernel, class Compact>
+std::vector<double> brandesBetweenness(
+    const Compact& graph,
+    unsigned int threads,
+    std::vector<double>* edges = nullptr,
+    const std::vector<typename Compact::Index>* sources = nullptr,
+    const std::vector<double>* reach = nullptr,
+    double horizon = std::numeric_limits<double>::infinity())
+{
+    typedef typename Compact::Index Index;
+    const Index n = graph.verticesCount();
+    std::vector<Index> all;
+    if (sources == nullptr)
+    {
+        all.resize(n);
+        for (Index s = 0; s < n; ++s)
+            all[s] = s;
+        sources = &all;
+    }
+
+    BrandesAccumulator<Kernel, Compact> accumulator(
+        graph, threads, edges != nullptr, reach, horizon);
+    accumulator.add(sources->data(), sources->size());
+
+    std::vector<double> result(n, 0.0);
+    if (edges != nullptr)
+        edges->assign(graph.slotsCount(), 0.0);
+    accumulator.collect(result, edges);
+    return result;
+}
+
+/**
+ * Class: BrandesKernel
+ * --------------------
+ * Description: Single source step of Brandes' betweenness algorithm over a CompactGraph.
+ * The scratch arrays (path counts, distances, dependencies and the visit order, which is used
+ * both as the BFS queue and, read backwards, as the stack) are allocated once and only the
+ * entries touched by a source are reset afterwards. Predecessors are not stored: w precedes v
+ * on a shortest path from the source whenever d(v) = d(w) + 1, so dependencies are pulled from
+ * the successors of every vertex in reverse visit order.
+ * Every vertex may stand for reach(v) vertices of a larger graph whose paths to the rest go
+ * through it, as when a graph is split at its articulation points; the pairs are then weighted
+ * by reach(s) * reach(t), and by default every reach is 1.
+ * A finite horizon k limits the pairs to those at most k hops apart: the search does not go
+ * past depth k, so vertices farther from the source cost nothing.
+ */
+template <class Compact>
+class BrandesKernel
+{
+public:
+    typedef typename Compact::Index Index;
+    static const std::size_t BATCH = 1;
+
+    explicit BrandesKernel(
+        const Compact& graph,
+        const std::vector<double>* reach = nullptr,
+        double horizon = std::numeric_limits<double>::infinity())
+        : graph(graph),
+          sigma(graph.verticesCount(), 0.0),
+          delta(graph.verticesCount(), 0.0),
+          distance(graph.verticesCount(), -1),
+          reach(reach != nullptr ? *reach : std::vector<double>(graph.verticesCount(), 1.0)),
+          depth(horizon < std::numeric_limits<int>::max() ? int(horizon) : -1)
+    {
+        order.reserve(graph.verticesCount());
+    }
+
+    /**
+     * Method: accumulate
+     * ------------------
+     * Description: Adds the dependency of s on every other vertex v to accumulator[v] and,
+     * if requested, the dependency of s on every edge to the accumulator of its slot.
+     * @param s Index of the source vertex
+     * @param accumulator Dense array indexed by vertex index
+     * @param edgeAccumulator Dense array indexed by adjacency slot, or null
+     */
+    void accumulate(
+        Index s, std::vector<double>& accumulator, std::vector<double>* edgeAccumulator = nullptr)
+    {
+        sigma[s] = 1.0;
+        distance[s] = 0;
+        order.push_back(s);
+
+        for (std::size_t head = 0; head < order.size(); ++head)
+        {
+            const Index v = order[head];
+            if (distance[v] == depth)
+                continue;
+            const int next = distance[v] + 1;
+            for (const Index* w = graph.neighborsBegin(v); w != graph.neighborsEnd(v); ++w)
+            {
+                if (distance[*w] < 0)
+                {
+                    distance[*w] = next;
+                    order.push_back(*w);
+                }
+                if (distance[*w] == next)
+                    sigma[*w] += sigma[v];
+            }
+        }
+
+        // Vertices in order of non-increasing distance from s
+        for (auto it = order.rbegin(); it != order.rend(); ++it)
+        {
+            const Index v = *it;
+            const int next = distance[v] + 1;
+            double dependency = 0.0;
+            for (std::size_t e = graph.offset(v); e < graph.offset(v + 1); ++e)
+            {
+                const Index w = graph.target(e);
+                if (distance[w] != next)
+                    continue;
+                const double edgeDependency = (sigma[v] / sigma[w]) * (reach[w] + delta[w]);
+                dependency += edgeDependency;
+                if (edgeAccumulator != nullptr)
+                    (*edgeAccumulator)[e] += reach[s] * edgeDependency;
+            }
+            delta[v] = dependency;
+            if (v != s)
+                accumulator[v] += reach[s] * dependency;
+        }
+
+        for (const Index v : order)
+        {
+            sigma[v] = 0.0;
+            delta[v] = 0.0;
+            distance[v] = -1;
+        }
+        order.clear();
+    }
+
+    // Runs accumulate from each of the given sources.
+    void accumulate(
+        const Index* sources,
+        std::size_t count,
+        std::vector<double>& accumulator,
+        std::vector<double>* edgeAccumulator = nullptr)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            accumulate(sources[i], accumulator, edgeAccumulator);
+    }
+
+    static std::vector<double> betweenness(const Compact& graph, unsigned int threads)
+    {
+        return brandesBetweenness<BrandesKernel>(graph, threads);
+    }
+
+private:
+    const Compact& graph;
+    std::vector<double> sigma;
+    std::vector<double> delta;
+    std::vector<int> distance;
+    std::vector<Index> order;
+    const std::vector<double> reach;
+    // Largest distance searched, -1 for no limit.
+    const int depth;
+};
+
+/**
+ * Class: MultiSourceBrandesKernel
+ * -------------------------------
+ * Description: Brandes' algorithm for batches of up to 64 * Words sources, on top of a
+ * MultiSourceBFS. The search gives, level by level, the sources whose distance to every vertex
+ * is that level; the path counts are then pushed forward and the dependencies pulled backward
+ * through the same levels, so every adjacency list is scanned once per level for the whole
+ * batch instead of twice per source. Only the lanes at distance d(v) + 1 of a neighbor w take
+ * part in an edge (v, w), which is a word-wide AND. Vertices may stand for several, as in
+ * BrandesKernel, and the search stops at the horizon as in BrandesKernel.
+ * Path counts and dependencies take LANES doubles per vertex each.
+ */
+template <class Compact, unsigned int Words = 1>
+class MultiSourceBrandesKernel
+{
+public:
+    typedef typename Compact::Index Index;
+    typedef MultiSourceBFS<Compact, Words> Search;
+    typedef typename Search::Entry Entry;
+    typedef typename Search::Mask Mask;
+    static const std::size_t BATCH = Search::LANES;
+
+    explicit MultiSourceBrandesKernel(
+        const Compact& graph,
+        const std::vector<double>* reach = nullptr,
+        double horizon = std::numeric_limits<double>::infinity())
+        : graph(graph),
+          search(graph),
+          sigma(std::size_t(graph.verticesCount()) * BATCH, 0.0),
+          delta(std::size_t(graph.verticesCount()) * BATCH, 0.0),
+          level(graph.verticesCount(), Mask::none()),
+          reach(reach != nullptr ? *reach : std::vector<double>(graph.verticesCount(), 1.0)),
+          depth(horizon < std::numeric_limits<unsigned int>::max()
+                    ? (unsigned int)(horizon)
+                    : std::numeric_limits<unsigned int>::max())
+    {
+    }
+
+    /**
+     * Method: accumulate
+     * ------------------
+     * Description: Adds the dependency of the given sources on every other vertex v to
+     * accumulator[v] and, if requested, their dependency on every edge to the accumulator of
+     * its slot.
+     * @param sources Indices of distinct source vertices
+     * @param count Number of sources, at most BATCH
+     * @param accumulator Dense array indexed by vertex index
+     * @param edgeAccumulator Dense array indexed by adjacency slot, or null
+     */
+    void accumulate(
+        const Index* sources,
+        std::size_t count,
+        std::vector<double>& accumulator,
+        std::vector<double>* edgeAccumulator = nullptr)
+    {
+        search.run(sources, count, depth);
+        const unsigned int levels = search.levels();
+        double sourceReach[BATCH];
+        for (std::size_t lane = 0; lane < count; ++lane)
+            sourceReach[lane] = reach[sources[lane]];
+
+        for (const Entry* v = search.levelBegin(0); v != search.levelEnd(0); ++v)
+            v->sources.forEach([&](unsigned int lane) { sigma[row(v->vertex) + lane] = 1.0; });
+
+        for (unsigned int d = 1; d < levels; ++d)
+        {
+            mark(d);
+            for (const Entry* v = search.levelBegin(d - 1); v != search.levelEnd(d - 1); ++v)
+            {
+                const double* from = &sigma[row(v->vertex)];
+                for (const Index* w = graph.neighborsBegin(v->vertex);
+                     w != graph.neighborsEnd(v->vertex);
+                     ++w)
+                {
+                    double* to = &sigma[row(*w)];
+                    (v->sources & level[*w]).forEach([&](unsigned int lane) {
+                        to[lane] += from[lane];
+                    });
+                }
+            }
+            unmark(d);
+        }
+
+        for (unsigned int d = levels; d-- > 0;)
+        {
+            if (d + 1 < levels)
+                mark(d + 1);
+            for (const Entry* v = search.levelBegin(d); v != search.levelEnd(d); ++v)
+            {
+                const double* sigmaV = &sigma[row(v->vertex)];
+                double* deltaV = &delta[row(v->vertex)];
+                for (std::size_t e = graph.offset(v->vertex); e < graph.offset(v->vertex + 1);
+                     ++e)
+                {
+                    const Index w = graph.target(e);
+                    const double* sigmaW = &sigma[row(w)];
+                    const double* deltaW = &delta[row(w)];
+                    const double reachW = reach[w];
+                    double edgeDependency = 0.0;
+                    (v->sources & level[w]).forEach([&](unsigned int lane) {
+                        const double c = (sigmaV[lane] / sigmaW[lane]) * (reachW + deltaW[lane]);
+                        deltaV[lane] += c;
+                        edgeDependency += sourceReach[lane] * c;
+                    });
+                    if (edgeAccumulator != nullptr)
+                        (*edgeAccumulator)[e] += edgeDependency;
+                }
+                // Level 0 only holds the sources themselves.
+                if (d > 0)
+                    v->sources.forEach([&](unsigned int lane) {
+                        accumulator[v->vertex] += sourceReach[lane] * deltaV[lane];
+                    });
+            }
+            if (d + 1 < levels)
+                unmark(d + 1);
+        }
+
+        for (unsigned int d = 0; d < levels; ++d)
+        {
+            for (const Entry* v = search.levelBegin(d); v != search.levelEnd(d); ++v)
+            {
+                v->sources.forEach([&](unsigned int lane) {
+                    sigma[row(v->vertex) + lane] = 0.0;
+                    delta[row(v->vertex) + lane] = 0.0;
+                });
+            }
+        }
+    }
+
+    static std::vector<double> betweenness(const Compact& graph, unsigned int threads)
+    {
+        return brandesBetweenness<MultiSourceBrandesKernel>(graph, threads);
+    }
+
+private:
+    std::size_t row(Index v) const
+    {
+        return std::size_t(v) * BATCH;
+    }
+
+    // Makes level[v] the sources at distance d of v, for the vertices at level d.
+    void mark(unsigned int d)
+    {
+        for (const Entry* v = search.levelBegin(d); v != search.levelEnd(d); ++v)
+            level[v->vertex] = v->sources;
+    }
+
+    void unmark(unsigned int d)
+    {
+        for (const Entry* v = search.levelBegin(d); v != search.levelEnd(d); ++v)
+            level[v->vertex] = Mask::none();
+    }
+
+    const Compact& graph;
+    Search search;
+    std::vector<double> sigma;
+    std::vector<double> delta;
+    std::vector<Mask> level;
+    const std::vector<double> reach;
+    const unsigned int depth;
+};
+
+template <class Compact, unsigned int Words>
+const std::size_t MultiSourceBrandesKernel<Compact, Words>::BATCH;
+
+// Scratch memory allowed to the batched betweenness kernels of all the threads together.
+static const std::size_t MULTI_SOURCE_MEMORY = std::size_t(1) << 30;
+
+/*
+ * Fraction of the graph within the given number of hops of a vertex, averaged over a batch
+ * of sources spread evenly over the vertex indices.
+ */
+template <class Compact>
+double boundedReachFraction(const Compact& graph, unsigned int depth)
+{
+    typedef typename Compact::Index Index;
+    MultiSourceBFS<Compact> search(graph);
+    const Index n = graph.verticesCount();
+    const Index count = std::min<Index>(n, search.LANES);
+    std::vector<Index> sources;
+    for (Index lane = 0; lane < count; ++lane)
+        sources.push_back(Index(std::size_t(lane) * n / count));
+    search.run(sources.data(), sources.size(), depth);
+
+    double reached = 0.0;
+    for (unsigned int d = 0; d < search.levels(); ++d)
+        for (auto v = search.levelBegin(d); v != search.levelEnd(d); ++v)
+            reached += v->sources.count();
+    return reached / (double(sources.size()) * n);
+}
+
+// Whether unweightedBetweenness runs MultiSourceBrandesKernel on the graph with the given
+// number of threads (see there).
+template <class Compact>
+bool multiSourceBetweenness(
+    const Compact& graph,
+    unsigned int threads,
+    double horizon = std::numeric_limits<double>::infinity())
+{
+    typedef MultiSourceBrandesKernel<Compact> Batched;
+    const std::size_t bytes =
+        std::size_t(graph.verticesCount()) * Batched::BATCH * 2 * sizeof(double);
+    const bool local = horizon < graph.verticesCount() && graph.verticesCount() > 0 &&
+                       boundedReachFraction(graph, (unsigned int)(horizon)) < 0.125;
+    return bytes <= MULTI_SOURCE_MEMORY / ParallelFor::threadCount(threads) && !local;
+}
+
+/**
+ * Function: unweightedBetweenness
+ * -------------------------------
+ * Description: Betweenness by hop count. Uses MultiSourceBrandesKernel with 64 lanes while the
+ * path count and dependency arrays of all the threads stay within MULTI_SOURCE_MEMORY bytes,
+ * and the one-source BrandesKernel for larger graphs. With a horizon, the batches only pay off when
+ * the searches overlap, so the one-source kernel is also used when a sample of sources reaches
+ * less than an eighth of the graph within the horizon.
+ * @param graph Graph to analyze
+ * @param threads Number of threads, 0 meaning one per available core
+ * @param edges If not null, receives the betweenness of every adjacency slot of the graph
+ * @param sources If not null, the distinct sources whose dependencies are added up
+ * @param reach If not null, how many vertices every vertex stands for (see BrandesKernel)
+ * @param horizon Only pairs at most this many hops apart are counted
+ * @returns The betweenness of every vertex, indexed by vertex index
+ */
+template <class Compact>
+std::vector<double> unweightedBetweenness(
+    const Compact& graph,
+    unsigned int threads,
+    std::vector<double>* edges = nullptr,
+    const std::vector<typename Compact::Index>* sources = nullptr,
+    const std::vector<double>* reach = nullptr,
+    double horizon = std::numeric_limits<double>::infinity())
+{
+    if (multiSourceBetweenness(graph, threads, horizon))
+        return brandesBetweenness<MultiSourceBrandesKernel<Compact>>(
+            graph, threads, edges, sources, reach, horizon);
+    return brandesBetweenness<BrandesKernel<Compact>>(
+        graph, threads, edges, sources, reach, horizon);
+}
+
+// Sizes a Dijkstra queue for the vertices and edge weights of the graph.
+template <class Compact>
+void fitQueue(IndexedHeap<double>& queue, const Compact& graph)
+{
+    queue.reset(graph.verticesCount());
+}
+
+template <class Compact>
+void fitQueue(BucketQueue& queue, const Compact& graph)
+{
+    queue.reset(graph.verticesCount(), std::size_t(graph.maxWeight()));
+}
+
+/**
+ * Class: WeightedBrandesKernel
+ * ----------------------------
+ * Description: Single source step of Brandes' algorithm for positive edge weights. Distances
+ * are found with Dijkstra's algorithm on an indexed heap with decrease-key, and the vertices
+ * are recorded in the order they are settled, which read backwards gives non-increasing
+ * distance. As in BrandesKernel, w succeeds v on a shortest path whenever
+ * d(v) + weight(v, w) == d(w); both passes evaluate that sum the same way, so the floating
+ * point comparison is consistent. Vertices may stand for several, as in BrandesKernel, and
+ * with a finite horizon only vertices at distance at most horizon are ever queued.
+ * Template Argument Queue: IndexedHeap<double>, or BucketQueue when the weights are small
+ * positive integers
+ */
+template <class Compact, class Queue = IndexedHeap<double>>
+class WeightedBrandesKernel
+{
+public:
+    typedef typename Compact::Index Index;
+    static const std::size_t BATCH = 1;
+
+    explicit WeightedBrandesKernel(
+        const Compact& graph,
+        const std::vector<double>* reach = nullptr,
+        double horizon = INFINITE)
+        : graph(graph),
+          sigma(graph.verticesCount(), 0.0),
+          delta(graph.verticesCount(), 0.0),
+          distance(graph.verticesCount(), INFINITE),
+          reach(reach != nullptr ? *reach : std::vector<double>(graph.verticesCount(), 1.0)),
+          horizon(horizon)
+    {
+        fitQueue(queue, graph);
+        order.reserve(graph.verticesCount());
+    }
+
+    /**
+     * Method: accumulate
+     * ------------------
+     * Description: Adds the dependency of s on every other vertex v to accumulator[v] and,
+     * if requested, the dependency of s on every edge to the accumulator of its slot.
+     * @param s Index of the source vertex
+     * @param accumulator Dense array indexed by vertex index
+     * @param edgeAccumulator Dense array indexed by adjacency slot, or null
+     */
+    void accumulate(
+        Index s, std::vector<double>& accumulator, std::vector<double>* edgeAccumulator = nullptr)
+    {
+        sigma[s] = 1.0;
+        distance[s] = 0.0;
+        queue.push(s, 0.0);
+
+        while (!queue.empty())
+        {
+            const Index v = queue.pop();
+            order.push_back(v);
+            for (std::size_t e = graph.offset(v); e < graph.offset(v + 1); ++e)
+            {
+                const Index w = graph.target(e);
+                const double alternative = distance[v] + graph.weight(e);
+                if (alternative > horizon)
+                    continue;
+                if (alternative < distance[w])
+                {
+                    if (distance[w] == INFINITE)
+                        queue.push(w, alternative);
+                    else
+                        queue.decrease(w, alternative);
+                    distance[w] = alternative;
+                    sigma[w] = 0.0;
+                }
+                if (alternative == distance[w])
+                    sigma[w] += sigma[v];
+            }
+        }
+
+        // Vertices in order of non-increasing distance from s
+        for (auto it = order.rbegin(); it != order.rend(); ++it)
+        {
+            const Index v = *it;
+            double dependency = 0.0;
+            for (std::size_t e = graph.offset(v); e < graph.offset(v + 1); ++e)
+            {
+                const Index w = graph.target(e);
+                if (distance[v] + graph.weight(e) != distance[w])
+                    continue;
+                const double edgeDependency = (sigma[v] / sigma[w]) * (reach[w] + delta[w]);
+                dependency += edgeDependency;
+                if (edgeAccumulator != nullptr)
+                    (*edgeAccumulator)[e] += reach[s] * edgeDependency;
+            }
+            delta[v] = dependency;
+            if (v != s)
+                accumulator[v] += reach[s] * dependency;
+        }
+
+        for (const Index v : order)
+        {
+            sigma[v] = 0.0;
+            delta[v] = 0.0;
+            distance[v] = INFINITE;
+        }
+        order.clear();
+    }
+
+    // Runs accumulate from each of the given sources.
+    void accumulate(
+        const Index* sources,
+        std::size_t count,
+        std::vector<double>& accumulator,
+        std::vector<double>* edgeAccumulator = nullptr)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            accumulate(sources[i], accumulator, edgeAccumulator);
+    }
+
+    static std::vector<double> betweenness(const Compact& graph, unsigned int threads)
+    {
+        return brandesBetweenness<WeightedBrandesKernel>(graph, threads);
+    }
+
+private:
+    static constexpr double INFINITE = std::numeric_limits<double>::infinity();
+
+    const Compact& graph;
+    std::vector<double> sigma;
+    std::vector<double> delta;
+    std::vector<double> distance;
+    std::vector<Index> order;
+    const std::vector<double> reach;
+    const double horizon;
+    Queue queue;
+};
+
+template <class Compact, class Queue>
+constexpr double WeightedBrandesKernel<Compact, Queue>::INFINITE;
+
+// Largest integral weight for which weightedBetweenness uses bucket queues.
+static const double BUCKET_QUEUE_WIDTH = 4096;
+
+// Whether weightedBetweenness runs its searches on a BucketQueue (see there).
+template <class Compact>
+bool bucketQueueBetweenness(const Compact& graph)
+{
+    return graph.integralWeights() && graph.maxWeight() <= BUCKET_QUEUE_WIDTH;
+}
+
+/**
+ * Function: weightedBetweenness
+ * -----------------------------
+ * Description: Betweenness taking the edge weights as lengths. Dijkstra's searches run on a
+ * BucketQueue when every weight is an integer between 1 and BUCKET_QUEUE_WIDTH, and on an
+ * IndexedHeap otherwise.
+ * @param graph Graph to analyze
+ * @param threads Number of threads, 0 meaning one per available core
+ * @param edges If not null, receives the betweenness of every adjacency slot of the graph
+ * @param sources If not null, the distinct sources whose dependencies are added up
+ * @param reach If not null, how many vertices every vertex stands for (see BrandesKernel)
+ * @param horizon Only pairs at distance at most horizon are counted
+ * @returns The betweenness of every vertex, indexed by vertex index
+ */
+template <class Compact>
+std::vector<double> weightedBetweenness(
+    const Compact& graph,
+    unsigned int threads,
+    std::vector<double>* edges = nullptr,
+    const std::vector<typename Compact::Index>* sources = nullptr,
+    const std::vector<double>* reach = nullptr,
+    double horizon = std::numeric_limits<double>::infinity())
+{
+    if (bucketQueueBetweenness(graph))
+        return brandesBetweenness<WeightedBrandesKernel<Compact, BucketQueue>>(
+            graph, threads, edges, sources, reach, horizon);
+    return brandesBetweenness<WeightedBrandesKernel<Compact>>(
+        graph, threads, edges, sources, reach, horizon);
+}
+}  // namespace graphpp
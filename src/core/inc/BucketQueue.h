@@ -0,0 +1,113 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+namespace graphpp
+{
+/**
+ * Class: BucketQueue
+ * ------------------
+ * Description: Monotone priority queue over the integers [0, n) with small non-negative
+ * integer keys (Dial, 1969), a drop-in replacement for IndexedHeap in Dijkstra's algorithm
+ * when the edge weights are integers no greater than a width W. Keys waiting in the queue
+ * then lie within W of the last key popped, so W + 1 buckets used circularly hold them all.
+ * Push and decrease are O(1), moving the element between the doubly linked bucket lists, and
+ * a pop scans at most W + 1 buckets, which gives O(E + W·V) for a whole search.
+ * Keys are taken as doubles with integral values so that callers can switch queues freely.
+ */
+class BucketQueue
+{
+public:
+    typedef unsigned int Index;
+
+    explicit BucketQueue(Index n = 0, std::size_t width = 1)
+    {
+        reset(n, width);
+    }
+
+    // Resizes the universe of elements to [0, n) and the width to the given one, emptying
+    // the queue.
+    void reset(Index n, std::size_t width)
+    {
+        heads.assign(width + 1, Index(NONE));
+        next.assign(n, Index(NONE));
+        previous.assign(n, Index(NONE));
+        keys.assign(n, 0);
+        elements = 0;
+        current = 0;
+    }
+
+    bool empty() const
+    {
+        return elements == 0;
+    }
+
+    std::size_t size() const
+    {
+        return elements;
+    }
+
+    /*
+     * Adds i, which must not be in the queue, with a key within the width above the last key
+     * popped. An empty queue takes any key, which starts a new search.
+     */
+    void push(Index i, double key)
+    {
+        if (elements == 0 && (key < current || key > current + heads.size() - 1))
+            current = std::size_t(key);
+        keys[i] = std::size_t(key);
+        link(i);
+        ++elements;
+    }
+
+    // Lowers the key of i, which must be in the queue.
+    void decrease(Index i, double key)
+    {
+        unlink(i);
+        keys[i] = std::size_t(key);
+        link(i);
+    }
+
+    // Removes and returns an element with the smallest key.
+    Index pop()
+    {
+        while (heads[current % heads.size()] == NONE)
+            ++current;
+        const Index top = heads[current % heads.size()];
+        unlink(top);
+        --elements;
+        return top;
+    }
+
+private:
+    static const Index NONE = std::numeric_limits<Index>::max();
+
+    void link(Index i)
+    {
+        Index& head = heads[keys[i] % heads.size()];
+        previous[i] = NONE;
+        next[i] = head;
+        if (head != NONE)
+            previous[head] = i;
+        head = i;
+    }
+
+    void unlink(Index i)
+    {
+        if (previous[i] != NONE)
+            next[previous[i]] = next[i];
+        else
+            heads[keys[i] % heads.size()] = next[i];
+        if (next[i] != NONE)
+            previous[next[i]] = previous[i];
+    }
+
+    std::vector<Index> heads;
+    std::vector<Index> next;
+    std::vector<Index> previous;
+    std::vector<std::size_t> keys;
+    std::size_t elements;
+    std::size_t current;
+};
+}  // namespace graphpp
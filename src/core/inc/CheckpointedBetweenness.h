@@ -0,0 +1,229 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "BrandesKernel.h"
+#include "CompactGraph.h"
+#include "GraphExceptions.h"
+#include "IBetweenness.h"
+#include "mili/mili.h"
+
+namespace graphpp
+{
+/**
+ * Class: CheckpointedBetweenness
+ * ------------------------------
+ * Description: Exact betweenness for long runs that may be interrupted. The sources are
+ * processed in index order, in rounds of ROUND_BATCHES batches of the kernel per thread, whose
+ * dependencies are added to the running totals one round at a time. The kernels, chosen as by
+ * unweightedBetweenness and weightedBetweenness, and their accumulators live in one
+ * BrandesAccumulator for the whole run, so a round only costs its searches.
+ * After a round, if at least the given interval has passed since the last checkpoint, the
+ * totals and the number of sources done are written to a binary file (through a temporary
+ * file and a rename, so a checkpoint is never left half written). A run started with an
+ * existing checkpoint of the same graph resumes after its last round, and the file is removed
+ * once the run completes.
+ * Since rounds are added in order, a resumed run gives the same values as an uninterrupted one
+ * on the same number of threads: bit for bit with one thread, and up to rounding with several,
+ * whose partial sums depend on how the sources of a round were shared among them.
+ * Weighted graphs take the edge weights as lengths and directed graphs follow the edges in
+ * their direction. Undirected graphs are not split into biconnected blocks as by Betweenness,
+ * since the rounds follow the sources of the whole graph.
+ */
+template <class Graph, class Vertex>
+class CheckpointedBetweenness : public IBetweenness<Graph, Vertex>
+{
+public:
+    typedef typename IBetweenness<Graph, Vertex>::BetweennessContainer BetweennessContainer;
+    typedef typename IBetweenness<Graph, Vertex>::BetweennessIterator BetweennessIterator;
+    typedef CompactGraph<Graph, Vertex> Compact;
+    typedef typename Compact::Index Index;
+
+    // Batches of sources every thread runs in a round.
+    static const unsigned int ROUND_BATCHES = 16;
+
+    /**
+     * @param g Graph to analyze
+     * @param path Checkpoint file, read if it exists and written while running
+     * @param interval Minimum number of seconds between two checkpoints
+     * @param threads Number of threads, 0 meaning one per available core
+     * @param rounds Rounds to run before returning, 0 meaning all; a run stopped early keeps
+     * its checkpoint, as if it had been interrupted after the last of them
+     */
+    CheckpointedBetweenness(
+        Graph& g,
+        const std::string& path,
+        double interval,
+        unsigned int threads = 0,
+        unsigned int rounds = 0)
+        : compact(g), path(path), resumed(0), round(0)
+    {
+        const Index n = compact.verticesCount();
+        values.assign(n, 0.0);
+        Index done = 0;
+        if (read(done))
+            resumed = done;
+
+        if (Compact::weighted && bucketQueueBetweenness(compact))
+            run<WeightedBrandesKernel<Compact, BucketQueue>>(done, interval, threads, rounds);
+        else if (Compact::weighted)
+            run<WeightedBrandesKernel<Compact>>(done, interval, threads, rounds);
+        else if (multiSourceBetweenness(compact, threads))
+            run<MultiSourceBrandesKernel<Compact>>(done, interval, threads, rounds);
+        else
+            run<BrandesKernel<Compact>>(done, interval, threads, rounds);
+
+        for (Index i = 0; i < n; ++i)
+            betweenness[compact.vertex(i)->getVertexId()] = values[i];
+    }
+
+    virtual BetweennessIterator iterator()
+    {
+        return BetweennessIterator(betweenness);
+    }
+
+    // Number of sources taken from the checkpoint instead of being processed.
+    Index resumedSources() const
+    {
+        return resumed;
+    }
+
+    // Number of sources in a round.
+    std::size_t roundSources() const
+    {
+        return round;
+    }
+
+private:
+    // Processes the sources from done on, in rounds, writing checkpoints as it goes.
+    template <class Kernel>
+    void run(Index done, double interval, unsigned int threads, unsigned int rounds)
+    {
+        const Index n = compact.verticesCount();
+        round = std::size_t(ParallelFor::threadCount(threads)) * Kernel::BATCH * ROUND_BATCHES;
+        BrandesAccumulator<Kernel, Compact> accumulator(compact, threads);
+        std::vector<Index> sources;
+
+        auto last = std::chrono::steady_clock::now();
+        for (unsigned int r = 0; done < n && (rounds == 0 || r < rounds); ++r)
+        {
+            sources.clear();
+            for (Index s = done; s < n && sources.size() < round; ++s)
+                sources.push_back(s);
+            accumulator.add(sources.data(), sources.size());
+            accumulator.collect(values);
+            done += sources.size();
+
+            const auto now = std::chrono::steady_clock::now();
+            if (done < n && std::chrono::duration<double>(now - last).count() >= interval)
+            {
+                write(done);
+                last = now;
+            }
+        }
+
+        if (done < n)
+            write(done);
+        else
+            std::remove(path.c_str());
+    }
+
+    static constexpr char MAGIC[8] = {'C', 'N', 'B', 'T', 'W', 'N', '0', '1'};
+
+    struct Header
+    {
+        char magic[8];
+        uint64_t vertices;
+        uint64_t slots;
+        uint64_t fingerprint;
+        uint64_t done;
+    };
+
+    // FNV-1a hash of the vertex ids and the adjacency, so a checkpoint is only used for the
+    // graph it was made for.
+    uint64_t fingerprint() const
+    {
+        uint64_t hash = 14695981039346656037ull;
+        auto mix = [&hash](const void* data, std::size_t size) {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for (std::size_t i = 0; i < size; ++i)
+                hash = (hash ^ bytes[i]) * 1099511628211ull;
+        };
+        for (Index v = 0; v < compact.verticesCount(); ++v)
+        {
+            const uint64_t id = compact.vertex(v)->getVertexId();
+            mix(&id, sizeof(id));
+            for (std::size_t e = compact.offset(v); e < compact.offset(v + 1); ++e)
+            {
+                const uint64_t target = compact.target(e);
+                const double weight = compact.weight(e);
+                mix(&target, sizeof(target));
+                mix(&weight, sizeof(weight));
+            }
+        }
+        return hash;
+    }
+
+    // Loads the checkpoint, if there is one; throws InvalidCheckpoint if it does not belong
+    // to this graph.
+    bool read(Index& done)
+    {
+        std::ifstream file(path.c_str(), std::ios::binary);
+        if (!file)
+            return false;
+
+        Header header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (!file || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+            header.vertices != compact.verticesCount() || header.slots != compact.slotsCount() ||
+            header.fingerprint != fingerprint() || header.done > compact.verticesCount())
+            throw InvalidCheckpoint();
+        file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(double));
+        if (!file)
+            throw InvalidCheckpoint();
+        done = header.done;
+        return true;
+    }
+
+    void write(Index done) const
+    {
+        Header header;
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.vertices = compact.verticesCount();
+        header.slots = compact.slotsCount();
+        header.fingerprint = fingerprint();
+        header.done = done;
+
+        const std::string temporary = path + ".tmp";
+        {
+            std::ofstream file(temporary.c_str(), std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(
+                reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+            if (!file)
+                throw CheckpointNotWritten();
+        }
+        if (std::rename(temporary.c_str(), path.c_str()) != 0)
+            throw CheckpointNotWritten();
+    }
+
+    Compact compact;
+    const std::string path;
+    std::vector<double> values;
+    BetweennessContainer betweenness;
+    Index resumed;
+    std::size_t round;
+};
+
+template <class Graph, class Vertex>
+const unsigned int CheckpointedBetweenness<Graph, Vertex>::ROUND_BATCHES;
+
+template <class Graph, class Vertex>
+constexpr char CheckpointedBetweenness<Graph, Vertex>::MAGIC[8];
+}  // namespace graphpp
@@ -1,9 +1,25 @@
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
+#include "CompactGraph.h"
 #include "IClusteringCoefficient.h"
+#include "SetIntersection.h"
+#include "TriangleCounting.h"
 
 namespace graphpp
 {
+/**
+ * Class: ClusteringCoefficient
+ * ----------------------------
+ * Description: Clustering coefficient of the vertices of an undirected graph: the fraction of
+ * the pairs of distinct neighbors of a vertex that are joined by an edge. Parallel edges count
+ * once and loops are ignored.
+ * The coefficients of the whole graph are computed from the triangle counts of
+ * localClustering; a single vertex intersects the neighborhoods of its neighbors with its own,
+ * as sorted arrays of vertex ids, with SetIntersection.
+ */
 template <class Graph, class Vertex>
 class ClusteringCoefficient : public IClusteringCoefficient<Graph, Vertex>
 {
@@ -32,38 +48,75 @@ public:
 
     virtual double vertexClusteringCoefficient(Vertex* vertex)
     {
-        double links = 0.0;
-        auto it = vertex->neighborsIterator();
-        double ret;
+        const std::vector<Vertex*> neighbors = neighborhood(vertex);
+        const double k = neighbors.size();
+        if (k < 2)
+            return 0;
 
-        while (!it.end())
+        // Every edge between two neighbors is found from both ends.
+        std::vector<VertexId> own;
+        std::vector<VertexId> theirs;
+        ids(neighbors, own);
+        double links = 0.0;
+        for (Vertex* n : neighbors)
         {
-            Vertex* n = *it;
+            ids(neighborhood(n), theirs);
+            links += SetIntersection::size(
+                own.data(), own.data() + own.size(), theirs.data(), theirs.data() + theirs.size());
+        }
+        return links / (k * (k - 1));
+    }
 
-            auto innerIter = n->neighborsIterator();
+    virtual std::vector<double> vertexClusteringCoefficients(Graph& g, unsigned int threads = 0)
+    {
+        const CompactGraph<Graph, Vertex> compact(g);
+        return localClustering(compact, threads);
+    }
 
-            while (!innerIter.end())
-            {
-                Vertex* i = *innerIter;
-                // if i is neighbour of vertex, we close a triangle
-                if (i->isNeighbourOf(vertex))
-                {
-                    links += 1.0;
-                }
+    virtual double transitivity(Graph& g, unsigned int threads = 0)
+    {
+        typedef typename CompactGraph<Graph, Vertex>::Index Index;
+        const CompactGraph<Graph, Vertex> compact(g);
+        const ForwardGraph<CompactGraph<Graph, Vertex>> forward(compact);
+        const std::vector<std::size_t> triangles = triangleCounts(forward, threads);
+        double closed = 0.0;
+        double wedges = 0.0;
+        for (Index v = 0; v < compact.verticesCount(); ++v)
+        {
+            const double k = forward.simpleDegree(v);
+            closed += triangles[v];
+            wedges += k * (k - 1) / 2;
+        }
+        return wedges == 0.0 ? 0.0 : closed / wedges;
+    }
 
-                ++innerIter;
-            }
+private:
+    typedef typename Vertex::VertexId VertexId;
 
+    // Distinct neighbors of v other than itself, sorted by id.
+    static std::vector<Vertex*> neighborhood(Vertex* v)
+    {
+        std::vector<Vertex*> neighbors;
+        neighbors.reserve(v->degree());
+        auto it = v->neighborsIterator();
+        while (!it.end())
+        {
+            if (*it != v)
+                neighbors.push_back(static_cast<Vertex*>(*it));
             ++it;
         }
+        std::sort(neighbors.begin(), neighbors.end(), [](Vertex* a, Vertex* b) {
+            return a->getVertexId() < b->getVertexId();
+        });
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+        return neighbors;
+    }
 
-        // This is to avoid division by cero
-        if (vertex->degree() == 0 || vertex->degree() == 1)
-            ret = 0;
-        else
-            ret = links / (vertex->degree() * (vertex->degree() - 1));
-
-        return ret;
+    static void ids(const std::vector<Vertex*>& vertices, std::vector<VertexId>& out)
+    {
+        out.clear();
+        for (Vertex* v : vertices)
+            out.push_back(v->getVertexId());
     }
 };
 }  // namespace graphpp
@@ -0,0 +1,313 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "SetIntersection.h"
+#include "WeightedVertexAspect.h"
+
+namespace graphpp
+{
+/**
+ * Class: EdgeWeights
+ * ------------------
+ * Description: Tells CompactGraph how to read the weight of an edge. Unweighted vertices give
+ * every edge weight 1; the specialization below reads WeightedVertexAspect weights.
+ */
+template <class Vertex>
+struct EdgeWeights
+{
+    static const bool weighted = false;
+
+    static double weight(Vertex*, Vertex*)
+    {
+        return 1.0;
+    }
+};
+
+template <class T>
+struct EdgeWeights<WeightedVertexAspect<T>>
+{
+    static const bool weighted = true;
+
+    static double weight(WeightedVertexAspect<T>* v, WeightedVertexAspect<T>* w)
+    {
+        return v->edgeWeight(w);
+    }
+};
+
+/**
+ * Class: CompactGraph
+ * -------------------
+ * Description: Read-only snapshot of a graph in compressed sparse row form. Vertices are
+ * numbered 0..n-1 in the order the graph iterates them, and the neighbors of every vertex are
+ * stored contiguously, sorted by index. Algorithms that sweep the whole graph many times use it
+ * to index dense arrays by vertex instead of looking vertex ids up in maps.
+ * Every adjacency entry (slot) has an offset in [0, slotsCount()), so per-edge data can be kept
+ * in arrays aligned with the adjacency; edge weights, for weighted graphs, are stored that way.
+ * For directed graphs the rows hold the out-neighbors.
+ */
+template <class Graph, class Vertex>
+class CompactGraph
+{
+public:
+    typedef unsigned int Index;
+    typedef typename Vertex::VertexId VertexId;
+    static const bool weighted = EdgeWeights<Vertex>::weighted;
+
+    explicit CompactGraph(Graph& g) : maximum(1.0), integral(true)
+    {
+        auto it = g.verticesIterator();
+        while (!it.end())
+        {
+            indices[(*it)->getVertexId()] = vertices.size();
+            vertices.push_back(*it);
+            ++it;
+        }
+
+        std::vector<std::pair<Index, double>> row;
+        offsets.reserve(vertices.size() + 1);
+        offsets.push_back(0);
+        for (Vertex* v : vertices)
+        {
+            row.clear();
+            auto neighbourIter = v->neighborsIterator();
+            while (!neighbourIter.end())
+            {
+                Vertex* w = static_cast<Vertex*>(*neighbourIter);
+                row.push_back(
+                    std::make_pair(indexOf(w->getVertexId()), EdgeWeights<Vertex>::weight(v, w)));
+                ++neighbourIter;
+            }
+            std::sort(row.begin(), row.end());
+            for (const auto& entry : row)
+            {
+                targets.push_back(entry.first);
+                if (EdgeWeights<Vertex>::weighted)
+                    weights.push_back(entry.second);
+            }
+            offsets.push_back(targets.size());
+        }
+
+        if (!weights.empty())
+            maximum = *std::max_element(weights.begin(), weights.end());
+        for (const double w : weights)
+            integral = integral && w >= 1.0 && w == std::floor(w);
+    }
+
+    /**
+     * Subgraph of graph induced by the given vertices, which must be sorted by index in graph;
+     * they keep that order in the subgraph.
+     */
+    CompactGraph(const CompactGraph& graph, const std::vector<Index>& subset)
+        : maximum(weighted ? 0.0 : 1.0), integral(true)
+    {
+        offsets.reserve(subset.size() + 1);
+        offsets.push_back(0);
+        for (const Index v : subset)
+        {
+            indices[graph.vertices[v]->getVertexId()] = vertices.size();
+            vertices.push_back(graph.vertices[v]);
+            for (std::size_t e = graph.offsets[v]; e < graph.offsets[v + 1]; ++e)
+            {
+                const auto found =
+                    std::lower_bound(subset.begin(), subset.end(), graph.targets[e]);
+                if (found == subset.end() || *found != graph.targets[e])
+                    continue;
+                targets.push_back(found - subset.begin());
+                if (weighted)
+                {
+                    weights.push_back(graph.weights[e]);
+                    maximum = std::max(maximum, graph.weights[e]);
+                    integral = integral && graph.weights[e] >= 1.0 &&
+                               graph.weights[e] == std::floor(graph.weights[e]);
+                }
+            }
+            offsets.push_back(targets.size());
+        }
+        if (weights.empty())
+            maximum = 1.0;
+    }
+
+    Index verticesCount() const
+    {
+        return vertices.size();
+    }
+
+    // Number of adjacency entries; twice the number of edges for undirected graphs.
+    std::size_t slotsCount() const
+    {
+        return targets.size();
+    }
+
+    Vertex* vertex(Index i) const
+    {
+        return vertices[i];
+    }
+
+    bool contains(VertexId id) const
+    {
+        return indices.count(id) != 0;
+    }
+
+    Index indexOf(VertexId id) const
+    {
+        return indices.find(id)->second;
+    }
+
+    Index degree(Index i) const
+    {
+        return offsets[i + 1] - offsets[i];
+    }
+
+    const Index* neighborsBegin(Index i) const
+    {
+        return targets.data() + offsets[i];
+    }
+
+    const Index* neighborsEnd(Index i) const
+    {
+        return targets.data() + offsets[i + 1];
+    }
+
+    // Slot of the first neighbor of i; the neighbors of i use slots offset(i)..offset(i+1)-1.
+    std::size_t offset(Index i) const
+    {
+        return offsets[i];
+    }
+
+    // Slot of the edge from -> to, or slotsCount() if there is no such edge.
+    std::size_t slot(Index from, Index to) const
+    {
+        const Index* found = std::lower_bound(neighborsBegin(from), neighborsEnd(from), to);
+        if (found == neighborsEnd(from) || *found != to)
+            return slotsCount();
+        return found - targets.data();
+    }
+
+    /*
+     * Slot of the reverse of the edge in the given slot of from, or slotsCount() if there is
+     * none. Parallel edges are paired in order, so each slot has its own twin.
+     */
+    std::size_t twin(Index from, std::size_t slot) const
+    {
+        const Index to = targets[slot];
+        const Index* first = std::lower_bound(neighborsBegin(from), neighborsEnd(from), to);
+        const std::size_t rank = slot - (first - targets.data());
+        const std::size_t reverse = this->slot(to, from);
+        if (reverse == slotsCount() || reverse + rank >= offsets[to + 1] ||
+            targets[reverse + rank] != from)
+            return slotsCount();
+        return reverse + rank;
+    }
+
+    /*
+     * Calls found(w, uw, vw) for every distinct common neighbor w of u and v other than
+     * themselves, by increasing index, with the slots of an edge joining w to each of them.
+     * For directed graphs these are the common out-neighbors.
+     */
+    template <class Found>
+    void commonNeighbors(Index u, Index v, Found found) const
+    {
+        const Index* uRow = neighborsBegin(u);
+        const Index* vRow = neighborsBegin(v);
+        bool any = false;
+        Index last = 0;
+        SetIntersection::intersect(
+            uRow, neighborsEnd(u), vRow, neighborsEnd(v), [&](const Index* a, const Index* b) {
+                if ((any && *a == last) || *a == u || *a == v)
+                    return;
+                any = true;
+                last = *a;
+                found(*a, offsets[u] + (a - uRow), offsets[v] + (b - vRow));
+            });
+    }
+
+    Index target(std::size_t slot) const
+    {
+        return targets[slot];
+    }
+
+    // Weight of the edge in the given slot, 1 for unweighted graphs.
+    double weight(std::size_t slot) const
+    {
+        return EdgeWeights<Vertex>::weighted ? weights[slot] : 1.0;
+    }
+
+    // Largest edge weight, 1 for unweighted graphs.
+    double maxWeight() const
+    {
+        return maximum;
+    }
+
+    // Whether every edge weight is a positive integer, as for unweighted graphs.
+    bool integralWeights() const
+    {
+        return integral;
+    }
+
+private:
+    std::vector<Vertex*> vertices;
+    std::unordered_map<VertexId, Index> indices;
+    std::vector<std::size_t> offsets;
+    std::vector<Index> targets;
+    std::vector<double> weights;
+    double maximum;
+    bool integral;
+};
+
+template <class Graph, class Vertex>
+const bool CompactGraph<Graph, Vertex>::weighted;
+
+/**
+ * Class: ReverseAdjacency
+ * -----------------------
+ * Description: In-neighbors of every vertex of a directed CompactGraph, in the same compressed
+ * sparse row form: sorted by index, with one entry per out-neighbor entry of the graph.
+ */
+template <class Compact>
+class ReverseAdjacency
+{
+public:
+    typedef typename Compact::Index Index;
+
+    explicit ReverseAdjacency(const Compact& graph)
+        : offsets(graph.verticesCount() + 1, 0), sources(graph.slotsCount())
+    {
+        // Sorted because the sources are visited in order.
+        const Index n = graph.verticesCount();
+        for (std::size_t e = 0; e < graph.slotsCount(); ++e)
+            ++offsets[graph.target(e) + 1];
+        for (Index v = 0; v < n; ++v)
+            offsets[v + 1] += offsets[v];
+        std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+        for (Index v = 0; v < n; ++v)
+        {
+            for (const Index* w = graph.neighborsBegin(v); w != graph.neighborsEnd(v); ++w)
+                sources[next[*w]++] = v;
+        }
+    }
+
+    Index degree(Index i) const
+    {
+        return offsets[i + 1] - offsets[i];
+    }
+
+    const Index* neighborsBegin(Index i) const
+    {
+        return sources.data() + offsets[i];
+    }
+
+    const Index* neighborsEnd(Index i) const
+    {
+        return sources.data() + offsets[i + 1];
+    }
+
+private:
+    std::vector<std::size_t> offsets;
+    std::vector<Index> sources;
+};
+}  // namespace graphpp
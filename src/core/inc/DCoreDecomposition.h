@@ -0,0 +1,231 @@
+#pragma once
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "CompactGraph.h"
+#include "IDCoreDecomposition.h"
+
+namespace graphpp
+{
+/**
+ * Function: dCoreNumbers
+ * ----------------------
+ * Description: D-cores of a directed graph (Giatsidis et al., "D-cores: measuring collaboration
+ * of directed graphs based on degeneracy", 2011). The (k, l)-D-core is the largest subgraph
+ * where every vertex has in-degree at least k and out-degree at least l.
+ * For every k, the (k, 0)-D-core is peeled from the (k - 1, 0)-D-core by removing vertices
+ * with in-degree below k; then l is raised one step at a time, and at every step the vertices
+ * left with out-degree below l are removed, along with every vertex that this leaves with
+ * in-degree below k or out-degree below l. A vertex removed at step l belongs to the
+ * (k, l - 1)-D-core but not to the (k, l) one. The vertices are kept in lazy buckets by
+ * out-degree, so every k costs one linear sweep over the (k - 1, 0)-D-core for all l.
+ * Parallel edges count once per copy.
+ * @param graph Directed graph to analyze, whose rows hold the out-neighbors
+ * @returns For every k, the vertices of the (k, 0)-D-core paired with the largest l such that
+ * they belong to the (k, l)-D-core
+ */
+template <class Compact>
+std::vector<std::vector<std::pair<typename Compact::Index, unsigned int>>> dCoreNumbers(
+    const Compact& graph)
+{
+    typedef typename Compact::Index Index;
+    enum State : unsigned char
+    {
+        GONE,
+        ALIVE,
+        QUEUED
+    };
+
+    // Rows of in-neighbors.
+    const Index n = graph.verticesCount();
+    std::vector<std::size_t> inOffsets(n + 1, 0);
+    for (std::size_t s = 0; s < graph.slotsCount(); ++s)
+        ++inOffsets[graph.target(s) + 1];
+    for (Index v = 0; v < n; ++v)
+        inOffsets[v + 1] += inOffsets[v];
+    std::vector<Index> sources(graph.slotsCount());
+    {
+        std::vector<std::size_t> next(inOffsets.begin(), inOffsets.end() - 1);
+        for (Index u = 0; u < n; ++u)
+        {
+            for (const Index* w = graph.neighborsBegin(u); w != graph.neighborsEnd(u); ++w)
+                sources[next[*w]++] = u;
+        }
+    }
+
+    std::vector<std::vector<std::pair<Index, unsigned int>>> levels;
+    std::vector<unsigned char> state(n, GONE);
+    std::vector<unsigned int> in(n);
+    std::vector<unsigned int> out(n);
+    std::vector<std::vector<Index>> buckets;
+    std::vector<Index> queue;
+    std::vector<Index> candidates(n);
+    for (Index v = 0; v < n; ++v)
+        candidates[v] = v;
+
+    for (unsigned int k = 0; !candidates.empty(); ++k)
+    {
+        for (const Index v : candidates)
+            state[v] = ALIVE;
+        unsigned int maximum = 0;
+        for (const Index v : candidates)
+        {
+            in[v] = 0;
+            for (std::size_t s = inOffsets[v]; s < inOffsets[v + 1]; ++s)
+                in[v] += state[sources[s]] != GONE;
+            out[v] = 0;
+            for (const Index* w = graph.neighborsBegin(v); w != graph.neighborsEnd(v); ++w)
+                out[v] += state[*w] != GONE;
+            maximum = std::max(maximum, out[v]);
+        }
+        buckets.assign(maximum + 1, std::vector<Index>());
+        for (const Index v : candidates)
+            buckets[out[v]].push_back(v);
+
+        // Removes the queued vertices and those they leave short of k or l.
+        unsigned int alive = candidates.size();
+        std::vector<std::pair<Index, unsigned int>>& level = *levels.emplace(levels.end());
+        auto peel = [&](unsigned int l) {
+            while (!queue.empty())
+            {
+                const Index v = queue.back();
+                queue.pop_back();
+                state[v] = GONE;
+                --alive;
+                if (l > 0)
+                    level.push_back(std::make_pair(v, l - 1));
+                for (const Index* w = graph.neighborsBegin(v); w != graph.neighborsEnd(v); ++w)
+                {
+                    if (state[*w] == ALIVE && --in[*w] < k)
+                    {
+                        state[*w] = QUEUED;
+                        queue.push_back(*w);
+                    }
+                }
+                for (std::size_t s = inOffsets[v]; s < inOffsets[v + 1]; ++s)
+                {
+                    const Index u = sources[s];
+                    if (state[u] != ALIVE)
+                        continue;
+                    if (--out[u] < l)
+                    {
+                        state[u] = QUEUED;
+                        queue.push_back(u);
+                    }
+                    else
+                        buckets[out[u]].push_back(u);
+                }
+            }
+        };
+
+        for (const Index v : candidates)
+        {
+            if (in[v] < k)
+            {
+                state[v] = QUEUED;
+                queue.push_back(v);
+            }
+        }
+        peel(0);
+        candidates.erase(
+            std::remove_if(
+                candidates.begin(), candidates.end(), [&](Index v) { return state[v] == GONE; }),
+            candidates.end());
+        if (candidates.empty())
+        {
+            levels.pop_back();
+            break;
+        }
+
+        for (unsigned int l = 1; alive > 0; ++l)
+        {
+            for (const Index v : buckets[l - 1])
+            {
+                if (state[v] == ALIVE && out[v] == l - 1)
+                {
+                    state[v] = QUEUED;
+                    queue.push_back(v);
+                }
+            }
+            peel(l);
+        }
+    }
+    return levels;
+}
+
+/**
+ * Class: DCoreDecomposition
+ * -------------------------
+ * Description: D-cores of a directed graph, computed by dCoreNumbers on a CompactGraph copy of
+ * it: the size of every non-empty (k, l)-D-core, and for every vertex the largest l for each k
+ * such that it belongs to the (k, l)-D-core.
+ */
+template <class Graph, class Vertex>
+class DCoreDecomposition : public IDCoreDecomposition<Graph, Vertex>
+{
+public:
+    typedef typename IDCoreDecomposition<Graph, Vertex>::VertexId VertexId;
+    typedef typename IDCoreDecomposition<Graph, Vertex>::DistributionContainer
+        DistributionContainer;
+    typedef typename IDCoreDecomposition<Graph, Vertex>::DistributionIterator
+        DistributionIterator;
+
+    DCoreDecomposition(Graph& g)
+    {
+        typedef CompactGraph<Graph, Vertex> Compact;
+        const Compact compact(g);
+        const auto levels = dCoreNumbers(compact);
+        for (typename Compact::Index v = 0; v < compact.verticesCount(); ++v)
+            outCores[compact.vertex(v)->getVertexId()];
+
+        std::vector<unsigned int> counts;
+        for (unsigned int k = 0; k < levels.size(); ++k)
+        {
+            counts.clear();
+            for (const auto& entry : levels[k])
+            {
+                // The (k, 0)-D-cores are nested, so every vertex gets its k in order.
+                outCores[compact.vertex(entry.first)->getVertexId()].push_back(entry.second);
+                if (counts.size() <= entry.second)
+                    counts.resize(entry.second + 1, 0);
+                ++counts[entry.second];
+            }
+            // Vertices in the (k, l)-D-core are those whose largest l is at least l.
+            unsigned int size = 0;
+            for (unsigned int l = counts.size(); l > 0; --l)
+            {
+                size += counts[l - 1];
+                sizes[std::make_pair(k, l - 1)] = size;
+            }
+        }
+    }
+
+    virtual DistributionIterator distribution()
+    {
+        return DistributionIterator(sizes);
+    }
+
+    virtual unsigned int inCoreNumber(VertexId v)
+    {
+        const auto found = outCores.find(v);
+        if (found == outCores.end() || found->second.empty())
+            return 0;
+        return found->second.size() - 1;
+    }
+
+    virtual int outCoreNumber(VertexId v, unsigned int k)
+    {
+        const auto found = outCores.find(v);
+        if (found == outCores.end() || k >= found->second.size())
+            return -1;
+        return found->second[k];
+    }
+
+private:
+    std::unordered_map<VertexId, std::vector<unsigned int>> outCores;
+    DistributionContainer sizes;
+};
+}  // namespace graphpp
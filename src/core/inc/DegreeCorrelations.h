@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "ParallelFor.h"
+
+namespace graphpp
+{
+/**
+ * Class: DegreeCorrelations
+ * -------------------------
+ * Description: Degree correlations of a graph, as dense arrays: the mean degree of the
+ * neighbors of every vertex (knn), indexed by vertex index; the knn(k) curve, the mean knn of
+ * the vertices of each degree k, indexed by k, with how many vertices have that degree; and
+ * the degree assortativity coefficient (Newman, "Assortative mixing in networks", 2002).
+ */
+class DegreeCorrelations
+{
+public:
+    std::vector<double> knn;
+    std::vector<double> curve;
+    std::vector<std::size_t> vertices;
+    double assortativity;
+
+    DegreeCorrelations() : assortativity(0.0) {}
+
+    // knn(k), 0 when no vertex has degree k.
+    double meanDegree(std::size_t k) const
+    {
+        return k < curve.size() ? curve[k] : 0.0;
+    }
+};
+
+/**
+ * Function: degreeCorrelations
+ * ----------------------------
+ * Description: DegreeCorrelations of a graph from one pass over its adjacency, in parallel.
+ * neighbors(v, add) must call add(weight, degree) for every neighbor counted for the vertex of
+ * index v, with the weight of their edge and the degree of the neighbor. The knn of v is the
+ * weighted mean of those degrees; the assortativity is their Pearson correlation with
+ * degrees[v] over every such pair, weighted by the edge weights. With each undirected edge
+ * seen from both ends, that is Newman's coefficient, and Leung and Chau's weighted one when the
+ * edges are weighted. knn(k) groups the vertices by keys[v].
+ * Every vertex keeps its own sums, which are reduced in vertex order, so the results do not
+ * depend on the number of threads.
+ * @param keys Degree of every vertex by which knn(k) is grouped
+ * @param degrees Degree of every vertex correlated with those of its neighbors
+ * @param neighbors Enumerates the counted neighbors of a vertex
+ * @param threads Number of threads to use, 0 meaning one per available core
+ */
+template <class Neighbors>
+DegreeCorrelations degreeCorrelations(
+    const std::vector<std::size_t>& keys, const std::vector<double>& degrees,
+    Neighbors neighbors, unsigned int threads = 1)
+{
+    const std::size_t n = keys.size();
+    struct Sums
+    {
+        double weight;
+        double degree;
+        double squares;
+    };
+    std::vector<Sums> sums(n);
+    ParallelFor::run(
+        n,
+        threads,
+        [&](unsigned int, std::size_t v) {
+            Sums own = {0.0, 0.0, 0.0};
+            neighbors(v, [&own](double weight, double degree) {
+                own.weight += weight;
+                own.degree += weight * degree;
+                own.squares += weight * degree * degree;
+            });
+            sums[v] = own;
+        },
+        256);
+
+    DegreeCorrelations correlations;
+    correlations.knn.resize(n);
+    double weight = 0.0, x = 0.0, y = 0.0, xx = 0.0, yy = 0.0, xy = 0.0;
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        const Sums& own = sums[v];
+        correlations.knn[v] = own.weight == 0.0 ? 0.0 : own.degree / own.weight;
+        if (keys[v] >= correlations.curve.size())
+        {
+            correlations.curve.resize(keys[v] + 1, 0.0);
+            correlations.vertices.resize(keys[v] + 1, 0);
+        }
+        correlations.curve[keys[v]] += correlations.knn[v];
+        ++correlations.vertices[keys[v]];
+
+        weight += own.weight;
+        x += own.weight * degrees[v];
+        xx += own.weight * degrees[v] * degrees[v];
+        y += own.degree;
+        yy += own.squares;
+        xy += own.degree * degrees[v];
+    }
+    for (std::size_t k = 0; k < correlations.curve.size(); ++k)
+    {
+        if (correlations.vertices[k] != 0)
+            correlations.curve[k] /= correlations.vertices[k];
+    }
+
+    if (weight != 0.0)
+    {
+        const double meanX = x / weight;
+        const double meanY = y / weight;
+        const double deviations = (xx / weight - meanX * meanX) * (yy / weight - meanY * meanY);
+        if (deviations > 0.0)
+            correlations.assortativity = (xy / weight - meanX * meanY) / std::sqrt(deviations);
+    }
+    return correlations;
+}
+}  // namespace graphpp
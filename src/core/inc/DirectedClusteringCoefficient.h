@@ -1,10 +1,27 @@
 #pragma once
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "CompactGraph.h"
+#include "DirectedTriangleCensus.h"
 #include "IClusteringCoefficient.h"
 #include "typedefs.h"
 
 namespace graphpp
 {
+/**
+ * Class: DirectedClusteringCoefficient
+ * ------------------------------------
+ * Description: Clustering coefficients of the vertices of a directed graph, derived from the
+ * DirectedTriangles census. The out and in flags select Fagiolo's OUT and IN coefficients
+ * (OUT when neither is set); with both, the in and out triangles are divided by
+ * k_tot (k_tot - 1). fagioloClusteringCoefficients gives any DirectedClustering kind.
+ * The whole graph is counted in parallel by directedTriangleCensus; a single vertex
+ * intersects the out-neighbors of each of its neighbors with its own neighborhood, as sorted
+ * arrays of vertex ids.
+ */
 template <class Graph, class Vertex>
 class DirectedClusteringCoefficient : public IClusteringCoefficient<Graph, Vertex>
 {
@@ -44,90 +61,43 @@ public:
 
     virtual double vertexClusteringCoefficient(Vertex* vertex, bool out, bool in)
     {
-        DirectedVertex* directedVertex = static_cast<DirectedVertex*>(vertex);
-
-        if (!in && !out)
-        {
-            // Do out by default
-            out = true;
-        }
-
-        double outLinks = 0.0;
-        double inLinks = 0.0;
-
-        if (in)
-        {
-            auto outer = directedVertex->inNeighborsIterator();
-            while (!outer.end())
-            {
-                DirectedVertex* j = static_cast<DirectedVertex*>(*outer);
-
-                auto inner = directedVertex->inNeighborsIterator();
-                while (!inner.end())
-                {
-                    DirectedVertex* h = static_cast<DirectedVertex*>(*inner);
-
-                    if (isDirectedAdjacent(j, h))
-                    {
-                        inLinks += 1.0;
-                    }
-
-                    ++inner;
-                }
-
-                ++outer;
-            }
-        }
-
-        if (out)
-        {
-            auto outer = directedVertex->outNeighborsIterator();
-            while (!outer.end())
-            {
-                DirectedVertex* j = static_cast<DirectedVertex*>(*outer);
-
-                auto inner = directedVertex->outNeighborsIterator();
-                while (!inner.end())
-                {
-                    DirectedVertex* h = static_cast<DirectedVertex*>(*inner);
-
-                    if (isDirectedAdjacent(j, h))
-                    {
-                        outLinks += 1.0;
-                    }
-
-                    ++inner;
-                }
-
-                ++outer;
-            }
-        }
+        return coefficient(census(static_cast<DirectedVertex*>(vertex)), out, in);
+    }
 
-        double degree = 0.0;
-        double links = 0.0;
+    virtual double vertexClusteringCoefficient(Vertex* vertex)
+    {
+        return vertexClusteringCoefficient(vertex, false, false);
+    }
 
-        if (out && in)
-        {
-            links = inLinks + outLinks;
-            degree = directedVertex->inOutDegree();
-        }
-        else if (in)
-        {
-            links = inLinks;
-            degree = directedVertex->inDegree();
-        }
-        else
-        {
-            links = outLinks;
-            degree = directedVertex->outDegree();
-        }
+    virtual std::vector<double> vertexClusteringCoefficients(Graph& g, unsigned int threads = 0)
+    {
+        return vertexClusteringCoefficients(g, false, false, threads);
+    }
 
-        if (degree != 0 && degree != 1)
-        {
-            return links / (degree * (degree - 1));
-        }
+    virtual std::vector<double> vertexClusteringCoefficients(
+        Graph& g, bool out, bool in, unsigned int threads = 0)
+    {
+        const CompactGraph<Graph, Vertex> compact(g);
+        const std::vector<DirectedTriangles> all = directedTriangleCensus(compact, threads);
+        std::vector<double> values(all.size());
+        for (std::size_t v = 0; v < all.size(); ++v)
+            values[v] = coefficient(all[v], out, in);
+        return values;
+    }
 
-        return 0.0;
+    /*
+     * Clustering coefficient of the given kind of every vertex of g, in the order g iterates
+     * them, from one census of the graph.
+     */
+    std::vector<double> fagioloClusteringCoefficients(
+        Graph& g, DirectedClustering kind, unsigned int threads = 0)
+    {
+        const CompactGraph<Graph, Vertex> compact(g);
+        const std::vector<DirectedTriangles> all = directedTriangleCensus(compact, threads);
+        std::vector<double> values(all.size());
+        for (std::size_t v = 0; v < all.size(); ++v)
+            values[v] = all[v].clustering(kind);
+        return values;
     }
 
     // true if a --> b
@@ -148,9 +118,72 @@ public:
         return false;
     }
 
-    virtual double vertexClusteringCoefficient(Vertex* vertex)
+private:
+    typedef DirectedTriangles::Value VertexId;
+
+    static double coefficient(const DirectedTriangles& census, bool out, bool in)
     {
-        return vertexClusteringCoefficient(vertex, false, false);
+        if (!in && !out)
+        {
+            // Do out by default
+            out = true;
+        }
+
+        if (out && in)
+        {
+            const double degree = census.inDegree + census.outDegree;
+            return degree < 2 ? 0.0 : (census.in + census.out) / (degree * (degree - 1));
+        }
+        return census.clustering(in ? IN : OUT);
+    }
+
+    // Census of a single vertex from its in- and out-neighbors.
+    static DirectedTriangles census(DirectedVertex* vertex)
+    {
+        struct Neighbor
+        {
+            VertexId id;
+            unsigned char flag;
+            DirectedVertex* vertex;
+        };
+        std::vector<Neighbor> all;
+        for (auto it = vertex->outNeighborsIterator(); !it.end(); ++it)
+            all.push_back({(*it)->getVertexId(), DirectedTriangles::FROM,
+                           static_cast<DirectedVertex*>(*it)});
+        for (auto it = vertex->inNeighborsIterator(); !it.end(); ++it)
+            all.push_back({(*it)->getVertexId(), DirectedTriangles::TO,
+                           static_cast<DirectedVertex*>(*it)});
+        std::sort(all.begin(), all.end(), [](const Neighbor& a, const Neighbor& b) {
+            return a.id < b.id;
+        });
+
+        std::vector<VertexId> ids;
+        std::vector<unsigned char> flags;
+        std::vector<DirectedVertex*> vertices;
+        for (const Neighbor& neighbor : all)
+        {
+            if (neighbor.vertex == vertex)
+                continue;
+            if (!ids.empty() && ids.back() == neighbor.id)
+            {
+                flags.back() |= neighbor.flag;
+                continue;
+            }
+            ids.push_back(neighbor.id);
+            flags.push_back(neighbor.flag);
+            vertices.push_back(neighbor.vertex);
+        }
+
+        std::vector<VertexId> row;
+        return DirectedTriangles::count(
+            vertex->getVertexId(), ids.data(), flags.data(), ids.size(), [&](std::size_t k) {
+                row.clear();
+                for (auto it = vertices[k]->outNeighborsIterator(); !it.end(); ++it)
+                    row.push_back((*it)->getVertexId());
+                std::sort(row.begin(), row.end());
+                const VertexId* begin = row.data();
+                return std::make_pair(begin, begin + row.size());
+            });
     }
 };
 }  // namespace graphpp
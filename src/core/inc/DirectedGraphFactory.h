@@ -1,10 +1,15 @@
 #pragma once
 
+#include "BoundedBetweenness.h"
+#include "CheckpointedBetweenness.h"
+#include "DCoreDecomposition.h"
 #include "DirectedClusteringCoefficient.h"
 #include "DirectedDegreeDistribution.h"
 #include "DirectedNearestNeighborsDegree.h"
 #include "GraphReader.h"
+#include "EdgeBetweenness.h"
 #include "IGraphFactory.h"
+#include "ShortestPathLengths.h"
 #include "DirectedBetweenness.h"
 
 namespace graphpp
@@ -17,14 +22,40 @@ public:
     {
         return new GraphReader<Graph, Vertex>();
     }
-    virtual IBetweenness<Graph, Vertex>* createBetweenness(DirectedGraph& g)
+    virtual IBetweenness<Graph, Vertex>* createBetweenness(
+        DirectedGraph& g, unsigned int threads = 0)
     {
-        return new DirectedBetweenness<Graph,Vertex>(g);
+        return new DirectedBetweenness<Graph, Vertex>(g, threads);
+    }
+    virtual IBetweenness<Graph, Vertex>* createCheckpointedBetweenness(
+        DirectedGraph& g, const std::string& path, double interval, unsigned int threads = 0)
+    {
+        return new CheckpointedBetweenness<Graph, Vertex>(g, path, interval, threads);
+    }
+    virtual IBetweenness<Graph, Vertex>* createBoundedBetweenness(
+        DirectedGraph& g, double k, unsigned int threads = 0)
+    {
+        return new BoundedBetweenness<Graph, Vertex>(g, k, threads);
+    }
+    virtual IEdgeBetweenness<Graph, Vertex>* createEdgeBetweenness(
+        DirectedGraph& g, unsigned int threads = 0)
+    {
+        return new EdgeBetweenness<Graph, Vertex>(g, threads);
+    }
+    virtual IBetweenness<Graph, Vertex>* createApproximateBetweenness(
+        DirectedGraph&, double, double, double, unsigned int = 0)
+    {
+        return nullptr;
     }
     virtual IClusteringCoefficient<Graph, Vertex>* createClusteringCoefficient()
     {
         return new DirectedClusteringCoefficient<Graph, Vertex>();
     }
+    virtual IClusteringCoefficient<Graph, Vertex>* createApproximateClusteringCoefficient(
+        double, double, std::size_t)
+    {
+        return nullptr;
+    }
     virtual INearestNeighborsDegree<Graph, Vertex>* createNearestNeighborsDegree()
     {
         return new DirectedNearestNeighborsDegree<Graph, Vertex>();
@@ -35,6 +66,23 @@ public:
         // return new DirectedShellIndex<Graph,Vertex>();
         return nullptr;
     }
+    virtual IShellIndex<Graph, Vertex>* createParallelShellIndex(Graph&, unsigned int = 0)
+    {
+        return nullptr;
+    }
+    virtual ITrussDecomposition<Graph, Vertex>* createTrussDecomposition(Graph&, unsigned int = 0)
+    {
+        return nullptr;
+    }
+    virtual IDCoreDecomposition<Graph, Vertex>* createDCoreDecomposition(Graph& g)
+    {
+        return new DCoreDecomposition<Graph, Vertex>(g);
+    }
+    virtual IShortestPathLengths<Graph, Vertex>* createShortestPathLengths(
+        Graph& g, unsigned int threads = 0)
+    {
+        return new ShortestPathLengths<Graph, Vertex>(g, threads);
+    }
     virtual IDegreeDistribution<Graph, Vertex>* createDegreeDistribution(Graph& g)
     {
         return new DirectedDegreeDistribution<Graph, Vertex>(g);
@@ -1,9 +1,22 @@
 #pragma once
 
+#include <vector>
+
+#include "CompactGraph.h"
 #include "INearestNeighborsDegree.h"
 
 namespace graphpp
 {
+/**
+ * Class: DirectedNearestNeighborsDegree
+ * -------------------------------------
+ * Description: Mean neighbor degree of the vertices of a directed graph. The out flag averages
+ * the out-degrees of the out-neighbors and the in flag the in-degrees of the in-neighbors (out
+ * when neither is set); with both, the two sums are added and divided by the total degree.
+ * The whole graph is computed from a CompactGraph and its ReverseAdjacency by
+ * degreeCorrelations, which correlates the same degree of every vertex with those of its
+ * neighbors for the assortativity. knn(k) groups the vertices by degree(), their out-degree.
+ */
 template <class Graph, class Vertex>
 class DirectedNearestNeighborsDegree : public INearestNeighborsDegree<Graph, Vertex>
 {
@@ -110,5 +123,52 @@ public:
     {
         return meanDegreeForVertex(v, false, false);
     }
+
+    virtual DegreeCorrelations degreeCorrelations(
+        Graph& g, bool out, bool in, unsigned int threads = 0)
+    {
+        typedef typename CompactGraph<Graph, Vertex>::Index Index;
+        if (!out && !in)
+        {
+            // Do out by default
+            out = true;
+        }
+
+        const CompactGraph<Graph, Vertex> compact(g);
+        const ReverseAdjacency<CompactGraph<Graph, Vertex>> reverse(compact);
+        std::vector<std::size_t> keys(compact.verticesCount());
+        std::vector<double> outDegrees(keys.size());
+        std::vector<double> inDegrees(keys.size());
+        std::vector<double> degrees(keys.size(), 0.0);
+        for (Index v = 0; v < keys.size(); ++v)
+        {
+            keys[v] = compact.degree(v);
+            outDegrees[v] = compact.degree(v);
+            inDegrees[v] = reverse.degree(v);
+            degrees[v] = (out ? outDegrees[v] : 0.0) + (in ? inDegrees[v] : 0.0);
+        }
+        return graphpp::degreeCorrelations(
+            keys, degrees,
+            [&](Index v, const auto& add) {
+                if (in)
+                {
+                    for (const Index* w = reverse.neighborsBegin(v); w != reverse.neighborsEnd(v);
+                         ++w)
+                        add(1.0, inDegrees[*w]);
+                }
+                if (out)
+                {
+                    for (const Index* w = compact.neighborsBegin(v); w != compact.neighborsEnd(v);
+                         ++w)
+                        add(1.0, outDegrees[*w]);
+                }
+            },
+            threads);
+    }
+
+    virtual DegreeCorrelations degreeCorrelations(Graph& g, unsigned int threads = 0)
+    {
+        return degreeCorrelations(g, false, false, threads);
+    }
 };
 }  // namespace graphpp
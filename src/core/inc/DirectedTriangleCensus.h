@@ -0,0 +1,217 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "CompactGraph.h"
+#include "ParallelFor.h"
+#include "SetIntersection.h"
+
+namespace graphpp
+{
+/**
+ * Enum: DirectedClustering
+ * ------------------------
+ * Description: Clustering coefficients of a vertex i of a directed graph with adjacency
+ * matrix A, by the kind of triangle they count (Fagiolo, "Clustering in complex directed
+ * networks", 2007). With in-degree k_in, out-degree k_out, total degree k_tot = k_in + k_out
+ * and k_rec reciprocated neighbors:
+ * - CYCLE: i -> j -> h -> i, (A^3)_ii over k_in k_out - k_rec.
+ * - MIDDLEMAN: h -> i -> j and h -> j, (A A^T A)_ii over k_in k_out - k_rec.
+ * - IN: j -> i, h -> i and j -> h, (A^T A^2)_ii over k_in (k_in - 1).
+ * - OUT: i -> j, i -> h and j -> h, (A^2 A^T)_ii over k_out (k_out - 1).
+ * - TOTAL: every triangle regardless of direction, the sum of the four over
+ *   k_tot (k_tot - 1) - 2 k_rec.
+ */
+enum DirectedClustering
+{
+    CYCLE,
+    MIDDLEMAN,
+    IN,
+    OUT,
+    TOTAL
+};
+
+/**
+ * Class: DirectedTriangles
+ * ------------------------
+ * Description: Triangle census of one vertex of a directed graph: how many ordered pairs of
+ * its neighbors close each kind of triangle of DirectedClustering, and its distinct in, out
+ * and reciprocated neighbors. Loops and parallel edges are ignored.
+ */
+class DirectedTriangles
+{
+public:
+    typedef SetIntersection::Value Value;
+
+    // Direction flags of a neighbor of the vertex.
+    static const unsigned char FROM = 1;
+    static const unsigned char TO = 2;
+
+    std::size_t cycle;
+    std::size_t middleman;
+    std::size_t in;
+    std::size_t out;
+    std::size_t inDegree;
+    std::size_t outDegree;
+    std::size_t reciprocal;
+
+    DirectedTriangles() : cycle(0), middleman(0), in(0), out(0), inDegree(0), outDegree(0),
+                          reciprocal(0)
+    {
+    }
+
+    /**
+     * Method: count
+     * -------------
+     * Description: Census of the vertex self from its neighbors, sorted without repeats,
+     * flagged FROM when self points to them and TO when they point to self, and the sorted
+     * out-neighbors outRow(k) of the k-th neighbor, as a pair of pointers. Every neighbor's
+     * out-neighbors are intersected once with the neighbors of self, and every common one
+     * is classified by the flags of both.
+     */
+    template <class OutRow>
+    static DirectedTriangles count(
+        Value self, const Value* neighbors, const unsigned char* flags, std::size_t size,
+        OutRow outRow)
+    {
+        DirectedTriangles census;
+        for (std::size_t k = 0; k < size; ++k)
+        {
+            census.outDegree += (flags[k] & FROM) != 0;
+            census.inDegree += (flags[k] & TO) != 0;
+            census.reciprocal += flags[k] == (FROM | TO);
+        }
+
+        for (std::size_t k = 0; k < size; ++k)
+        {
+            // Neighbors h of self with j -> h, j being the k-th, by their flags; parallel
+            // edges of j may report h more than once, in a row.
+            const std::pair<const Value*, const Value*> row = outRow(k);
+            std::size_t closing[4] = {0, 0, 0, 0};
+            const Value* last = nullptr;
+            SetIntersection::intersect(
+                neighbors, neighbors + size, row.first, row.second,
+                [&](const Value* h, const Value*) {
+                    if (h != last && *h != self && *h != neighbors[k])
+                        ++closing[flags[h - neighbors]];
+                    last = h;
+                });
+
+            // With self -> j, j -> h closes an out triangle if self -> h and a cycle if
+            // h -> self; with j -> self, a middleman and an in triangle.
+            const std::size_t toH = closing[FROM] + closing[FROM | TO];
+            const std::size_t fromH = closing[TO] + closing[FROM | TO];
+            const unsigned char jFlags = flags[k];
+            if (jFlags & FROM)
+            {
+                census.out += toH;
+                census.cycle += fromH;
+            }
+            if (jFlags & TO)
+            {
+                census.in += fromH;
+                census.middleman += toH;
+            }
+        }
+        return census;
+    }
+
+    // Clustering coefficient of the given kind, 0 when the vertex has no such pairs.
+    double clustering(DirectedClustering kind) const
+    {
+        double triangles = 0.0;
+        double pairs = 0.0;
+        const double kIn = inDegree;
+        const double kOut = outDegree;
+        switch (kind)
+        {
+            case CYCLE:
+                triangles = cycle;
+                pairs = kIn * kOut - reciprocal;
+                break;
+            case MIDDLEMAN:
+                triangles = middleman;
+                pairs = kIn * kOut - reciprocal;
+                break;
+            case IN:
+                triangles = in;
+                pairs = kIn * (kIn - 1);
+                break;
+            case OUT:
+                triangles = out;
+                pairs = kOut * (kOut - 1);
+                break;
+            case TOTAL:
+                triangles = cycle + middleman + in + out;
+                pairs = (kIn + kOut) * (kIn + kOut - 1) - 2.0 * reciprocal;
+                break;
+        }
+        return pairs <= 0.0 ? 0.0 : triangles / pairs;
+    }
+};
+
+/**
+ * Function: directedTriangleCensus
+ * --------------------------------
+ * Description: DirectedTriangles of every vertex of a directed graph, in parallel. The rows
+ * of the CompactGraph hold the out-neighbors; the in-neighbors are gathered into a
+ * ReverseAdjacency once, and every vertex merges both into one flagged neighborhood.
+ * @param graph Directed graph to analyze
+ * @param threads Number of threads to use, 0 meaning one per available core
+ * @returns The census of every vertex, indexed by vertex index
+ */
+template <class Compact>
+std::vector<DirectedTriangles> directedTriangleCensus(
+    const Compact& graph, unsigned int threads = 1)
+{
+    typedef typename Compact::Index Index;
+    const Index n = graph.verticesCount();
+
+    const ReverseAdjacency<Compact> reverse(graph);
+
+    struct Scratch
+    {
+        std::vector<Index> neighbors;
+        std::vector<unsigned char> flags;
+    };
+    std::vector<Scratch> scratch(ParallelFor::threadCount(threads));
+    std::vector<DirectedTriangles> census(n);
+    ParallelFor::run(
+        n,
+        threads,
+        [&](unsigned int thread, std::size_t i) {
+            const Index v = i;
+            Scratch& own = scratch[thread];
+            own.neighbors.clear();
+            own.flags.clear();
+            const Index* out = graph.neighborsBegin(v);
+            const Index* in = reverse.neighborsBegin(v);
+            const Index* outEnd = graph.neighborsEnd(v);
+            const Index* inEnd = reverse.neighborsEnd(v);
+            while (out != outEnd || in != inEnd)
+            {
+                const Index w = in == inEnd || (out != outEnd && *out < *in) ? *out : *in;
+                unsigned char flag = 0;
+                for (; out != outEnd && *out == w; ++out)
+                    flag |= DirectedTriangles::FROM;
+                for (; in != inEnd && *in == w; ++in)
+                    flag |= DirectedTriangles::TO;
+                if (w == v)
+                    continue;
+                own.neighbors.push_back(w);
+                own.flags.push_back(flag);
+            }
+            census[v] = DirectedTriangles::count(
+                v, own.neighbors.data(), own.flags.data(), own.neighbors.size(),
+                [&](std::size_t k) {
+                    const Index w = own.neighbors[k];
+                    return std::make_pair(graph.neighborsBegin(w), graph.neighborsEnd(w));
+                });
+        },
+        64);
+    return census;
+}
+}  // namespace graphpp
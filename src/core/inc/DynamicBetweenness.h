@@ -0,0 +1,163 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "BrandesKernel.h"
+#include "CompactGraph.h"
+#include "GraphExceptions.h"
+#include "IBetweenness.h"
+#include "mili/mili.h"
+
+namespace graphpp
+{
+/**
+ * Class: DynamicBetweenness
+ * -------------------------
+ * Description: Betweenness of an unweighted graph kept up to date while edges are added and
+ * removed through it. The dependencies of a source only change when the edge (u, v) lies on
+ * one of its shortest path DAGs before or after the change, and in an undirected graph that
+ * happens exactly when d(s, u) != d(s, v). Two searches, from u and from v, find those
+ * sources; their old dependencies are subtracted on the graph before the change and their new
+ * ones added on the graph after it, and every other source is left alone. Edges between
+ * vertices at the same distance of most sources, typical of dense regions, are cheap to
+ * update; when half the sources or more are affected, as with bridges, the betweenness is
+ * recomputed from scratch instead.
+ * Directed graphs recompute every source, since their criterion needs distances towards u
+ * and v. The set of vertices must not change while the object is in use: updates on vertices
+ * the graph did not have at construction throw VertexNotFound. The values
+ * drift by rounding errors after very long sequences of updates.
+ */
+template <class Graph, class Vertex>
+class DynamicBetweenness : public IBetweenness<Graph, Vertex>
+{
+public:
+    typedef typename IBetweenness<Graph, Vertex>::BetweennessContainer BetweennessContainer;
+    typedef typename IBetweenness<Graph, Vertex>::BetweennessIterator BetweennessIterator;
+
+    DynamicBetweenness(Graph& g, unsigned int threads = 0)
+        : graph(g), threads(threads), compact(new Compact(g)), affected(0)
+    {
+        values = unweightedBetweenness(*compact, threads);
+    }
+
+    virtual BetweennessIterator iterator()
+    {
+        betweenness.clear();
+        for (Index i = 0; i < compact->verticesCount(); ++i)
+            betweenness[compact->vertex(i)->getVertexId()] = values[i];
+        return BetweennessIterator(betweenness);
+    }
+
+    /**
+     * Method: addEdge
+     * ---------------
+     * Description: Adds the edge s - d to the graph and updates the betweenness. If the graph
+     * throws, as DuplicateEdge for an existing edge of a simple graph, nothing changes.
+     */
+    void addEdge(Vertex* s, Vertex* d)
+    {
+        update(s, d, true);
+    }
+
+    /**
+     * Method: removeEdge
+     * ------------------
+     * Description: Removes the edge s - d from the graph, if present, and updates the
+     * betweenness.
+     */
+    void removeEdge(Vertex* s, Vertex* d)
+    {
+        if (s->isNeighbourOf(d))
+            update(s, d, false);
+    }
+
+    // Number of sources recomputed by the last update.
+    unsigned int affectedSources() const
+    {
+        return affected;
+    }
+
+private:
+    typedef CompactGraph<Graph, Vertex> Compact;
+    typedef typename Compact::Index Index;
+
+    void update(Vertex* s, Vertex* d, bool insert)
+    {
+        if (!compact->contains(s->getVertexId()) || !compact->contains(d->getVertexId()))
+            throw VertexNotFound();
+        const Index u = compact->indexOf(s->getVertexId());
+        const Index v = compact->indexOf(d->getVertexId());
+
+        // The graph is changed first, so that an edge it refuses, like a duplicate in a simple
+        // graph, leaves the values untouched; the snapshot still holds the graph before.
+        if (insert)
+            graph.addEdge(s, d);
+        else
+            graph.removeEdge(s, d);
+
+        const std::vector<Index> sources = affectedBy(u, v);
+        affected = sources.size();
+
+        // Each source is searched twice, so past half of them starting over is cheaper.
+        const bool partial = 2 * sources.size() < compact->verticesCount();
+        if (partial)
+            accumulate(sources, -1.0);
+        compact.reset(new Compact(graph));
+        if (partial)
+            accumulate(sources, 1.0);
+        else
+            values = unweightedBetweenness(*compact, threads);
+    }
+
+    std::vector<Index> affectedBy(Index u, Index v) const
+    {
+        std::vector<Index> sources;
+        const std::vector<int> fromU = distances(u);
+        const std::vector<int> fromV = distances(v);
+        for (Index s = 0; s < compact->verticesCount(); ++s)
+        {
+            if (graph.isDigraph() || fromU[s] != fromV[s])
+                sources.push_back(s);
+        }
+        return sources;
+    }
+
+    // Hop distances from s, -1 for the vertices it does not reach.
+    std::vector<int> distances(Index s) const
+    {
+        std::vector<int> distance(compact->verticesCount(), -1);
+        std::vector<Index> queue(1, s);
+        distance[s] = 0;
+        for (std::size_t head = 0; head < queue.size(); ++head)
+        {
+            const Index v = queue[head];
+            for (const Index* w = compact->neighborsBegin(v); w != compact->neighborsEnd(v); ++w)
+            {
+                if (distance[*w] < 0)
+                {
+                    distance[*w] = distance[v] + 1;
+                    queue.push_back(*w);
+                }
+            }
+        }
+        return distance;
+    }
+
+    // Adds the dependencies of the given sources on the current graph, times sign.
+    void accumulate(const std::vector<Index>& sources, double sign)
+    {
+        const std::vector<double> dependencies =
+            unweightedBetweenness(*compact, threads, nullptr, &sources);
+        for (Index v = 0; v < dependencies.size(); ++v)
+            values[v] += sign * dependencies[v];
+    }
+
+    Graph& graph;
+    const unsigned int threads;
+    std::unique_ptr<Compact> compact;
+    std::vector<double> values;
+    BetweennessContainer betweenness;
+    unsigned int affected;
+};
+}  // namespace graphpp
@@ -0,0 +1,300 @@
+#pragma once
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#include "CompactGraph.h"
+#include "IShellIndex.h"
+#include "ShellIndex.h"
+#include "typedefs.h"
+
+namespace graphpp
+{
+/**
+ * Class: DynamicShellIndex
+ * ------------------------
+ * Description: Shell index of an undirected graph kept up to date while edges are added and
+ * removed through it, by the traversal algorithms of Sariyuce et al. ("Streaming algorithms
+ * for k-core decomposition", 2013). Adding or removing an edge (u, v) changes core numbers by
+ * at most one, and only those of vertices with core number K = min(K(u), K(v)) joined to the
+ * endpoint(s) of core number K through such vertices.
+ * Every vertex keeps its max-core degree MCD, the number of its neighbors whose core number is
+ * at least its own. On insertion, a vertex can only rise if more than K neighbors could
+ * support it: those above K, plus those at K whose MCD exceeds K (its purecore degree). The
+ * search from the endpoints only goes through vertices with enough of them, and a vertex found
+ * to lack support is evicted at once, withdrawing its support from the others. On removal, a
+ * vertex drops as soon as fewer than K neighbors keep a core number of at least K, and the
+ * drops are propagated to its neighbors at K.
+ * The graph is mirrored as dense adjacency lists, so updates only hash their two endpoints.
+ * The set of vertices must not change while the object is in use.
+ */
+template <class Graph, class Vertex>
+class DynamicShellIndex : public IShellIndex<Graph, Vertex>
+{
+public:
+    typedef typename IShellIndex<Graph, Vertex>::ShellIndexContainer ShellIndexContainer;
+    typedef typename IShellIndex<Graph, Vertex>::ShellIndexIterator ShellIndexIterator;
+
+    DynamicShellIndex(Graph& g) : graph(g), visited(0)
+    {
+        const CompactGraph<Graph, Vertex> compact(g);
+        const Index n = compact.verticesCount();
+        core = coreNumbers(compact);
+        adjacency.resize(n);
+        for (Index v = 0; v < n; ++v)
+        {
+            vertices.push_back(compact.vertex(v));
+            indices[compact.vertex(v)] = v;
+            adjacency[v].assign(compact.neighborsBegin(v), compact.neighborsEnd(v));
+        }
+        mcd.resize(n);
+        for (Index v = 0; v < n; ++v)
+            mcd[v] = maxCoreDegree(v);
+        marked.assign(n, 0);
+        support.assign(n, 0);
+    }
+
+    virtual ShellIndexIterator iterator()
+    {
+        shellIndex.clear();
+        for (Index v = 0; v < vertices.size(); ++v)
+            shellIndex[vertices[v]->getVertexId()] = core[v];
+        return ShellIndexIterator(shellIndex);
+    }
+
+    // Current shell index of v.
+    unsigned int shellIndexOf(Vertex* v) const
+    {
+        return core[indices.find(v)->second];
+    }
+
+    /**
+     * Method: addEdge
+     * ---------------
+     * Description: Adds the edge s - d to the graph and updates the shell indices.
+     */
+    void addEdge(Vertex* s, Vertex* d)
+    {
+        graph.addEdge(s, d);
+        const Index u = indices[s];
+        const Index v = indices[d];
+        adjacency[u].push_back(v);
+        adjacency[v].push_back(u);
+        mcd[u] += core[v] >= core[u];
+        mcd[v] += core[u] >= core[v];
+        const unsigned int k = std::min(core[u], core[v]);
+
+        std::vector<Index> stack;
+        for (const Index root : {u, v})
+        {
+            if (core[root] == k && !(marked[root] & VISITED))
+                visit(root, k, stack);
+        }
+        while (!stack.empty())
+        {
+            const Index w = stack.back();
+            stack.pop_back();
+            if (support[w] > int(k))
+            {
+                for (const Index x : adjacency[w])
+                {
+                    if (core[x] == k && mcd[x] > k && !(marked[x] & VISITED))
+                        visit(x, k, stack);
+                }
+            }
+            else if (!(marked[w] & EVICTED))
+                evict(w, k);
+        }
+
+        // The visited vertices that were not evicted rise to K + 1.
+        std::vector<Index> risen;
+        for (const Index w : touched)
+        {
+            if ((marked[w] & VISITED) && !(marked[w] & EVICTED))
+            {
+                mark(w, RISEN);
+                risen.push_back(w);
+                ++core[w];
+            }
+        }
+        for (const Index w : risen)
+        {
+            mcd[w] = maxCoreDegree(w);
+            for (const Index x : adjacency[w])
+            {
+                if (core[x] == k + 1 && !(marked[x] & RISEN))
+                    ++mcd[x];
+            }
+        }
+        clear();
+    }
+
+    /**
+     * Method: removeEdge
+     * ------------------
+     * Description: Removes the edge s - d from the graph, if present, and updates the shell
+     * indices.
+     */
+    void removeEdge(Vertex* s, Vertex* d)
+    {
+        if (!s->isNeighbourOf(d))
+            return;
+        graph.removeEdge(s, d);
+        const Index u = indices[s];
+        const Index v = indices[d];
+        adjacency[u].erase(std::find(adjacency[u].begin(), adjacency[u].end(), v));
+        adjacency[v].erase(std::find(adjacency[v].begin(), adjacency[v].end(), u));
+        mcd[u] -= core[v] >= core[u];
+        mcd[v] -= core[u] >= core[v];
+        const unsigned int k = std::min(core[u], core[v]);
+
+        std::vector<Index> dropped;
+        for (const Index root : {u, v})
+        {
+            if (core[root] != k || (marked[root] & VISITED))
+                continue;
+            mark(root, VISITED);
+            support[root] = mcd[root];
+            if (support[root] < int(k))
+                dismiss(root, k, dropped);
+        }
+
+        for (const Index w : dropped)
+        {
+            mcd[w] = maxCoreDegree(w);
+            for (const Index x : adjacency[w])
+            {
+                if (core[x] == k)
+                    --mcd[x];
+            }
+        }
+        clear();
+    }
+
+    // Number of vertices examined by the last update.
+    unsigned int visitedVertices() const
+    {
+        return visited;
+    }
+
+private:
+    typedef unsigned int Index;
+
+    enum Marks
+    {
+        TOUCHED = 1,
+        VISITED = 2,
+        EVICTED = 4,
+        RISEN = 8
+    };
+
+    // Neighbors whose core number is at least that of v.
+    unsigned int maxCoreDegree(Index v) const
+    {
+        unsigned int count = 0;
+        for (const Index w : adjacency[v])
+            count += core[w] >= core[v];
+        return count;
+    }
+
+    void mark(Index v, unsigned char flag)
+    {
+        if (!(marked[v] & TOUCHED))
+            touched.push_back(v);
+        marked[v] |= TOUCHED | flag;
+    }
+
+    // Starts examining v for a rise to k + 1 with its purecore degree as support.
+    void visit(Index v, unsigned int k, std::vector<Index>& stack)
+    {
+        mark(v, VISITED);
+        for (const Index w : adjacency[v])
+            support[v] += core[w] > k || (core[w] == k && mcd[w] > k);
+        stack.push_back(v);
+    }
+
+    /*
+     * Rules v out of rising, and every vertex left without enough support by it. Only the
+     * neighbors whose purecore degree counts an evicted vertex lose its support; the ones not
+     * visited yet start below zero and get their purecore degree added when visited.
+     */
+    void evict(Index v, unsigned int k)
+    {
+        std::vector<Index> stack(1, v);
+        mark(v, EVICTED);
+        while (!stack.empty())
+        {
+            const Index w = stack.back();
+            stack.pop_back();
+            if (mcd[w] <= k)
+                continue;
+            for (const Index x : adjacency[w])
+            {
+                if (core[x] != k)
+                    continue;
+                mark(x, 0);
+                if (--support[x] == int(k) && (marked[x] & VISITED) && !(marked[x] & EVICTED))
+                {
+                    mark(x, EVICTED);
+                    stack.push_back(x);
+                }
+            }
+        }
+    }
+
+    // Drops v to k - 1, and every neighbor left with fewer than k supporting neighbors.
+    void dismiss(Index v, unsigned int k, std::vector<Index>& dropped)
+    {
+        std::vector<Index> stack(1, v);
+        --core[v];
+        dropped.push_back(v);
+        while (!stack.empty())
+        {
+            const Index w = stack.back();
+            stack.pop_back();
+            for (const Index x : adjacency[w])
+            {
+                if (core[x] != k)
+                    continue;
+                if (!(marked[x] & VISITED))
+                {
+                    mark(x, VISITED);
+                    support[x] = mcd[x];
+                }
+                if (--support[x] < int(k))
+                {
+                    --core[x];
+                    dropped.push_back(x);
+                    stack.push_back(x);
+                }
+            }
+        }
+    }
+
+    void clear()
+    {
+        visited = 0;
+        for (const Index v : touched)
+        {
+            visited += (marked[v] & VISITED) != 0;
+            marked[v] = 0;
+            support[v] = 0;
+        }
+        touched.clear();
+    }
+
+    Graph& graph;
+    std::vector<Vertex*> vertices;
+    std::unordered_map<Vertex*, Index> indices;
+    std::vector<std::vector<Index>> adjacency;
+    std::vector<unsigned int> core;
+    std::vector<unsigned int> mcd;
+    // Scratch state of an update, reset through touched.
+    std::vector<unsigned char> marked;
+    std::vector<int> support;
+    std::vector<Index> touched;
+    ShellIndexContainer shellIndex;
+    unsigned int visited;
+};
+}  // namespace graphpp
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <vector>
+
+#include "BrandesKernel.h"
+#include "CompactGraph.h"
+#include "IBetweenness.h"
+#include "IEdgeBetweenness.h"
+#include "mili/mili.h"
+
+namespace graphpp
+{
+/**
+ * Class: EdgeBetweenness
+ * ----------------------
+ * Description: Betweenness of every edge, the number of shortest paths between ordered pairs
+ * of vertices that go through it (each divided by the number of shortest paths of the pair),
+ * together with the vertex betweenness, both from a single dependency accumulation pass.
+ * Weighted graphs take the edge weights as lengths and directed graphs follow the edges in
+ * their direction. The sources are distributed among the given number of threads.
+ */
+template <class Graph, class Vertex>
+class EdgeBetweenness : public IBetweenness<Graph, Vertex>, public IEdgeBetweenness<Graph, Vertex>
+{
+public:
+    typedef typename IBetweenness<Graph, Vertex>::BetweennessContainer BetweennessContainer;
+    typedef typename IBetweenness<Graph, Vertex>::BetweennessIterator BetweennessIterator;
+    typedef typename IEdgeBetweenness<Graph, Vertex>::VertexId VertexId;
+    typedef typename IEdgeBetweenness<Graph, Vertex>::Edge Edge;
+    typedef typename IEdgeBetweenness<Graph, Vertex>::EdgeBetweennessContainer
+        EdgeBetweennessContainer;
+    typedef typename IEdgeBetweenness<Graph, Vertex>::EdgeBetweennessIterator
+        EdgeBetweennessIterator;
+
+    EdgeBetweenness(Graph& g, unsigned int threads = 0) : compact(g)
+    {
+        std::vector<double> slots;
+        const std::vector<double> values =
+            EdgeWeights<Vertex>::weighted ? weightedBetweenness(compact, threads, &slots)
+                                          : unweightedBetweenness(compact, threads, &slots);
+
+        // Paths may cross an undirected edge either way; both slots get the total.
+        if (!g.isDigraph())
+        {
+            for (unsigned int v = 0; v < compact.verticesCount(); ++v)
+            {
+                for (std::size_t e = compact.offset(v); e < compact.offset(v + 1); ++e)
+                {
+                    const std::size_t twin = compact.twin(v, e);
+                    if (v < compact.target(e) && twin != compact.slotsCount())
+                        slots[e] = slots[twin] = slots[e] + slots[twin];
+                }
+            }
+        }
+
+        edges.reserve(compact.slotsCount());
+        for (unsigned int v = 0; v < compact.verticesCount(); ++v)
+        {
+            const VertexId from = compact.vertex(v)->getVertexId();
+            betweenness[from] = values[v];
+            for (std::size_t e = compact.offset(v); e < compact.offset(v + 1); ++e)
+            {
+                const VertexId to = compact.vertex(compact.target(e))->getVertexId();
+                edges.push_back(Edge{from, to, slots[e]});
+            }
+        }
+    }
+
+    virtual BetweennessIterator iterator()
+    {
+        return BetweennessIterator(betweenness);
+    }
+
+    virtual EdgeBetweennessIterator edgesIterator()
+    {
+        return EdgeBetweennessIterator(edges);
+    }
+
+    virtual double edgeBetweenness(VertexId from, VertexId to)
+    {
+        if (!compact.contains(from) || !compact.contains(to))
+            return -1.0;
+        const std::size_t e = compact.slot(compact.indexOf(from), compact.indexOf(to));
+        return e == compact.slotsCount() ? -1.0 : edges[e].betweenness;
+    }
+
+private:
+    CompactGraph<Graph, Vertex> compact;
+    BetweennessContainer betweenness;
+    EdgeBetweennessContainer edges;
+};
+}  // namespace graphpp
@@ -15,3 +15,37 @@ typedef GenericException<GraphExceptionHierarchy> GraphException;
  */
 DEFINE_SPECIFIC_EXCEPTION_TEXT(
     DuplicateEdge, GraphExceptionHierarchy, "Graph doesn't allow duplicate edges");
+
+/**
+ * Exception: VertexNotFound
+ * -------------------------
+ * Description: Exception used when an operation is given a vertex the graph does not have
+ */
+DEFINE_SPECIFIC_EXCEPTION_TEXT(
+    VertexNotFound, GraphExceptionHierarchy, "Vertex is not in the graph");
+
+/**
+ * Exception: UnboundedSampling
+ * ----------------------------
+ * Description: Exception used when a sampling based estimation is given neither an error
+ * bound nor a time or sample budget, so it would never stop
+ */
+DEFINE_SPECIFIC_EXCEPTION_TEXT(
+    UnboundedSampling, GraphExceptionHierarchy, "Sampling needs an error bound or a budget");
+
+/**
+ * Exception: InvalidCheckpoint
+ * ----------------------------
+ * Description: Exception used when a checkpoint file cannot be read or was written for a
+ * different graph
+ */
+DEFINE_SPECIFIC_EXCEPTION_TEXT(
+    InvalidCheckpoint, GraphExceptionHierarchy, "Checkpoint does not match the graph");
+
+/**
+ * Exception: CheckpointNotWritten
+ * -------------------------------
+ * Description: Exception used when a checkpoint file cannot be written
+ */
+DEFINE_SPECIFIC_EXCEPTION_TEXT(
+    CheckpointNotWritten, GraphExceptionHierarchy, "Checkpoint could not be written");
@@ -1,12 +1,20 @@
 #pragma once
 
+#include "ApproximateBetweenness.h"
+#include "ApproximateClustering.h"
 #include "Betweenness.h"
+#include "BoundedBetweenness.h"
+#include "CheckpointedBetweenness.h"
 #include "ClusteringCoefficient.h"
 #include "DegreeDistribution.h"
 #include "GraphReader.h"
+#include "EdgeBetweenness.h"
 #include "IGraphFactory.h"
 #include "NearestNeighborsDegree.h"
+#include "ParallelShellIndex.h"
 #include "ShellIndex.h"
+#include "ShortestPathLengths.h"
+#include "TrussDecomposition.h"
 
 namespace graphpp
 {
@@ -18,9 +26,29 @@ public:
     {
         return new GraphReader<Graph, Vertex>();
     }
-    virtual IBetweenness<Graph, Vertex>* createBetweenness(Graph& g)
+    virtual IBetweenness<Graph, Vertex>* createBetweenness(Graph& g, unsigned int threads = 0)
     {
-        return new Betweenness<Graph, Vertex>(g);
+        return new Betweenness<Graph, Vertex>(g, threads);
+    }
+    virtual IBetweenness<Graph, Vertex>* createCheckpointedBetweenness(
+        Graph& g, const std::string& path, double interval, unsigned int threads = 0)
+    {
+        return new CheckpointedBetweenness<Graph, Vertex>(g, path, interval, threads);
+    }
+    virtual IBetweenness<Graph, Vertex>* createBoundedBetweenness(
+        Graph& g, double k, unsigned int threads = 0)
+    {
+        return new BoundedBetweenness<Graph, Vertex>(g, k, threads);
+    }
+    virtual IEdgeBetweenness<Graph, Vertex>* createEdgeBetweenness(
+        Graph& g, unsigned int threads = 0)
+    {
+        return new EdgeBetweenness<Graph, Vertex>(g, threads);
+    }
+    virtual IBetweenness<Graph, Vertex>* createApproximateBetweenness(
+        Graph& g, double epsilon, double delta, double seconds, unsigned int threads = 0)
+    {
+        return new ApproximateBetweenness<Graph, Vertex>(g, epsilon, delta, seconds, threads);
     }
     virtual MaxClique<Graph, Vertex>* createMaxClique(Graph& g)
     {
@@ -34,6 +62,11 @@ public:
     {
         return new ClusteringCoefficient<Graph, Vertex>();
     }
+    virtual IClusteringCoefficient<Graph, Vertex>* createApproximateClusteringCoefficient(
+        double epsilon, double delta, std::size_t samples)
+    {
+        return new ApproximateClusteringCoefficient<Graph, Vertex>(epsilon, delta, samples);
+    }
     virtual INearestNeighborsDegree<Graph, Vertex>* createNearestNeighborsDegree()
     {
         return new NearestNeighborsDegree<Graph, Vertex>();
@@ -42,6 +75,25 @@ public:
     {
         return new ShellIndex<Graph, Vertex>(g);
     }
+    virtual IShellIndex<Graph, Vertex>* createParallelShellIndex(
+        Graph& g, unsigned int threads = 0)
+    {
+        return new ParallelShellIndex<Graph, Vertex>(g, threads);
+    }
+    virtual ITrussDecomposition<Graph, Vertex>* createTrussDecomposition(
+        Graph& g, unsigned int threads = 0)
+    {
+        return new TrussDecomposition<Graph, Vertex>(g, threads);
+    }
+    virtual IDCoreDecomposition<Graph, Vertex>* createDCoreDecomposition(Graph&)
+    {
+        return nullptr;
+    }
+    virtual IShortestPathLengths<Graph, Vertex>* createShortestPathLengths(
+        Graph& g, unsigned int threads = 0)
+    {
+        return new ShortestPathLengths<Graph, Vertex>(g, threads);
+    }
 
     virtual IDegreeDistribution<Graph, Vertex>* createDegreeDistribution(Graph& g)
     {
@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "Boxplotentry.h"
+#include "ParallelFor.h"
 #include "mili/mili.h"
 
 namespace graphpp
@@ -24,6 +25,77 @@ public:
         return clusteringCoefficient(g, d);
     }
 
+    /*
+     * Clustering coefficient of every vertex of g, in the order g iterates them, computed on
+     * the given number of threads (0 meaning one per available core). By default every vertex
+     * is computed by vertexClusteringCoefficient, spread among the threads by ParallelFor.
+     */
+    virtual std::vector<double> vertexClusteringCoefficients(Graph& g, unsigned int threads = 0)
+    {
+        return vertexValues<Vertex>(g, threads, [this](Vertex* v) {
+            return vertexClusteringCoefficient(v);
+        });
+    }
+
+    virtual std::vector<double> vertexClusteringCoefficients(
+        Graph& g, bool out, bool in, unsigned int threads = 0)
+    {
+        return vertexValues<Vertex>(g, threads, [this, out, in](Vertex* v) {
+            return vertexClusteringCoefficient(v, out, in);
+        });
+    }
+
+    /*
+     * C(k): the clustering coefficients of the vertices grouped by degree, as computed by
+     * vertexClusteringCoefficients in a single pass and split by groupByDegree. Each entry holds
+     * the mean, quartiles and number of values of one degree.
+     */
+    virtual std::vector<Boxplotentry> clusteringCoefficientByDegree(
+        Graph& g, unsigned int threads = 0)
+    {
+        return groupByDegree(g, vertexClusteringCoefficients(g, threads));
+    }
+
+    std::vector<Boxplotentry> clusteringCoefficientByDegree(
+        Graph& g, bool out, bool in, unsigned int threads = 0)
+    {
+        return groupByDegree(g, vertexClusteringCoefficients(g, out, in, threads));
+    }
+
+    /*
+     * Mean clustering coefficient of the vertices of g, those with fewer than two neighbors
+     * counting as 0.
+     */
+    virtual double averageClusteringCoefficient(Graph& g, unsigned int threads = 0)
+    {
+        const std::vector<double> values = vertexClusteringCoefficients(g, threads);
+        double sum = 0.0;
+        for (const double value : values)
+            sum += value;
+        return values.empty() ? 0.0 : sum / values.size();
+    }
+
+    /*
+     * Global transitivity of g: the fraction of its wedges, pairs of distinct neighbors of a
+     * vertex, that are joined by an edge, or three times its triangles over its wedges. By
+     * default the clustering coefficient of every vertex is weighed by the wedges its degree
+     * gives.
+     */
+    virtual double transitivity(Graph& g, unsigned int threads = 0)
+    {
+        const std::vector<double> values = vertexClusteringCoefficients(g, threads);
+        double closed = 0.0;
+        double wedges = 0.0;
+        auto it = g.verticesIterator();
+        for (std::size_t i = 0; !it.end(); ++it, ++i)
+        {
+            const double k = (*it)->degree();
+            closed += values[i] * k * (k - 1);
+            wedges += k * (k - 1);
+        }
+        return wedges == 0.0 ? 0.0 : closed / wedges;
+    }
+
     virtual ~IClusteringCoefficient() {}
 };
 }  // namespace graphpp
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <map>
+#include <utility>
+
+#include "mili/mili.h"
+
+namespace graphpp
+{
+template <class Graph, class Vertex>
+class IDCoreDecomposition
+{
+public:
+    typedef typename Vertex::VertexId VertexId;
+
+    // Number of vertices of every non-empty (k, l)-D-core, keyed by (k, l).
+    typedef std::map<std::pair<unsigned int, unsigned int>, unsigned int> DistributionContainer;
+    typedef CAutonomousIterator<DistributionContainer> DistributionIterator;
+
+    virtual DistributionIterator distribution() = 0;
+
+    // Largest k such that v belongs to the (k, 0)-D-core.
+    virtual unsigned int inCoreNumber(VertexId v) = 0;
+
+    // Largest l such that v belongs to the (k, l)-D-core, or -1 if v is not in the (k, 0) one.
+    virtual int outCoreNumber(VertexId v, unsigned int k) = 0;
+
+    virtual ~IDCoreDecomposition() {}
+};
+}  // namespace graphpp
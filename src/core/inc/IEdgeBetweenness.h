@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+
+#include "mili/mili.h"
+
+namespace graphpp
+{
+template <class Graph, class Vertex>
+class IEdgeBetweenness
+{
+public:
+    typedef typename Vertex::VertexId VertexId;
+
+    struct Edge
+    {
+        VertexId from;
+        VertexId to;
+        double betweenness;
+    };
+
+    /*
+     * One entry per adjacency entry of the graph, grouped by source vertex; for undirected
+     * graphs every edge appears once from each endpoint, with the same value.
+     */
+    typedef std::vector<Edge> EdgeBetweennessContainer;
+    typedef AutonomousIterator<EdgeBetweennessContainer> EdgeBetweennessIterator;
+
+    virtual EdgeBetweennessIterator edgesIterator() = 0;
+
+    // Betweenness of the edge from -> to, or -1 if there is no such edge.
+    virtual double edgeBetweenness(VertexId from, VertexId to) = 0;
+
+    virtual ~IEdgeBetweenness() {}
+};
+}  // namespace graphpp
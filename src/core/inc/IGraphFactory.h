@@ -1,11 +1,17 @@
 #pragma once
 
+#include <string>
+
 #include "IBetweenness.h"
 #include "IClusteringCoefficient.h"
+#include "IDCoreDecomposition.h"
+#include "IEdgeBetweenness.h"
 #include "IDegreeDistribution.h"
 #include "IGraphReader.h"
 #include "INearestNeighborsDegree.h"
 #include "IShellIndex.h"
+#include "IShortestPathLengths.h"
+#include "ITrussDecomposition.h"
 #include "MaxClique.h"
 #include "StrengthDistribution.h"
 #include "typedefs.h"
@@ -16,14 +22,83 @@ template <class Graph, class Vertex>
 class IGraphFactory
 {
 public:
-    virtual IBetweenness<Graph, Vertex>* createBetweenness(Graph& g) = 0;
+    /**
+     * Creates the betweenness of g, computed with the given number of threads (0 uses one
+     * per available core).
+     */
+    virtual IBetweenness<Graph, Vertex>* createBetweenness(Graph& g, unsigned int threads = 0) = 0;
+
+    /**
+     * Creates an estimate of the betweenness of g by sampling shortest paths, within
+     * epsilon of the normalized values with probability 1 - delta, or sampling for the
+     * given number of seconds. Returns nullptr where sampling is not supported.
+     */
+    virtual IBetweenness<Graph, Vertex>* createApproximateBetweenness(
+        Graph& g, double epsilon, double delta, double seconds, unsigned int threads = 0) = 0;
+
+    /**
+     * Creates the betweenness of g, saving its progress to the given file at least every
+     * interval seconds and resuming from that file if it already exists.
+     */
+    virtual IBetweenness<Graph, Vertex>* createCheckpointedBetweenness(
+        Graph& g, const std::string& path, double interval, unsigned int threads = 0) = 0;
+
+    /**
+     * Creates the betweenness of g counting only the shortest paths of length at most k,
+     * in hops or in total weight.
+     */
+    virtual IBetweenness<Graph, Vertex>* createBoundedBetweenness(
+        Graph& g, double k, unsigned int threads = 0) = 0;
+
+    /**
+     * Creates the betweenness of the edges (and vertices) of g, computed with the given number
+     * of threads (0 uses one per available core).
+     */
+    virtual IEdgeBetweenness<Graph, Vertex>* createEdgeBetweenness(
+        Graph& g, unsigned int threads = 0) = 0;
 
     virtual IClusteringCoefficient<Graph, Vertex>* createClusteringCoefficient() = 0;
 
+    /**
+     * Creates an estimate of the clustering coefficients by sampling wedges, within epsilon of
+     * the exact values with probability 1 - delta, or from the given number of samples per
+     * estimate. Returns nullptr where sampling is not supported.
+     */
+    virtual IClusteringCoefficient<Graph, Vertex>* createApproximateClusteringCoefficient(
+        double epsilon, double delta, std::size_t samples) = 0;
+
     virtual INearestNeighborsDegree<Graph, Vertex>* createNearestNeighborsDegree() = 0;
 
     virtual IShellIndex<Graph, Vertex>* createShellIndex(Graph& g) = 0;
 
+    /**
+     * Creates the shell index of g peeled in parallel with the given number of threads (0 uses
+     * one per available core). Returns nullptr where the shell index is not supported.
+     */
+    virtual IShellIndex<Graph, Vertex>* createParallelShellIndex(
+        Graph& g, unsigned int threads = 0) = 0;
+
+    /**
+     * Creates the truss decomposition of g, computed with the given number of threads (0 uses
+     * one per available core). Returns nullptr where it is not supported.
+     */
+    virtual ITrussDecomposition<Graph, Vertex>* createTrussDecomposition(
+        Graph& g, unsigned int threads = 0) = 0;
+
+    /**
+     * Creates the (k, l)-D-cores of g, by in- and out-degree. Returns nullptr for undirected
+     * graphs.
+     */
+    virtual IDCoreDecomposition<Graph, Vertex>* createDCoreDecomposition(Graph& g) = 0;
+
+    /**
+     * Creates the closeness and distance distribution of g by hop count, computed with the
+     * given number of threads (0 uses one per available core). Returns nullptr for weighted
+     * graphs.
+     */
+    virtual IShortestPathLengths<Graph, Vertex>* createShortestPathLengths(
+        Graph& g, unsigned int threads = 0) = 0;
+
     virtual IGraphReader<Graph, Vertex>* createGraphReader() = 0;
 
     virtual IDegreeDistribution<Graph, Vertex>* createDegreeDistribution(Graph& g) = 0;
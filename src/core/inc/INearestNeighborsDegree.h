@@ -1,5 +1,10 @@
 #pragma once
 
+#include <vector>
+
+#include "Boxplotentry.h"
+#include "DegreeCorrelations.h"
+
 namespace graphpp
 {
 template <class Graph, class Vertex>
@@ -21,6 +26,47 @@ public:
         return meanDegreeForVertex(vertex);
     }
 
+    /*
+     * DegreeCorrelations of g: the mean neighbor degree of every vertex, in the order g
+     * iterates them, knn(k) by the degree of the vertices and the degree assortativity, from
+     * one pass over the edges on the given number of threads (0 meaning one per available
+     * core).
+     */
+    virtual DegreeCorrelations degreeCorrelations(Graph& g, unsigned int threads = 0) = 0;
+
+    virtual DegreeCorrelations degreeCorrelations(
+        Graph& g, bool, bool, unsigned int threads = 0)
+    {
+        return degreeCorrelations(g, threads);
+    }
+
+    // Mean neighbor degree of every vertex of g, in the order g iterates them.
+    std::vector<double> vertexMeanDegrees(Graph& g, unsigned int threads = 0)
+    {
+        return degreeCorrelations(g, threads).knn;
+    }
+
+    std::vector<double> vertexMeanDegrees(Graph& g, bool out, bool in, unsigned int threads = 0)
+    {
+        return degreeCorrelations(g, out, in, threads).knn;
+    }
+
+    /*
+     * knn(k): the mean neighbor degrees of the vertices grouped by degree, as computed by
+     * vertexMeanDegrees in a single pass and split by groupByDegree. Each entry holds the mean,
+     * quartiles and number of values of one degree.
+     */
+    std::vector<Boxplotentry> meanDegreeByDegree(Graph& g, unsigned int threads = 0)
+    {
+        return groupByDegree(g, vertexMeanDegrees(g, threads));
+    }
+
+    std::vector<Boxplotentry> meanDegreeByDegree(
+        Graph& g, bool out, bool in, unsigned int threads = 0)
+    {
+        return groupByDegree(g, vertexMeanDegrees(g, out, in, threads));
+    }
+
     virtual ~INearestNeighborsDegree() {}
 };
 }  // namespace graphpp
@@ -2,11 +2,33 @@
 
 namespace graphpp
 {
+template <class T>
+class WeightedVertexAspect;
+
+/**
+ * Class: ShellIndexValue
+ * ----------------------
+ * Description: Type of the shell index of a vertex: the core number, an integer, for
+ * unweighted graphs, and the s-core number, a strength, for weighted ones.
+ */
+template <class Vertex>
+struct ShellIndexValue
+{
+    typedef unsigned int Type;
+};
+
+template <class T>
+struct ShellIndexValue<WeightedVertexAspect<T>>
+{
+    typedef double Type;
+};
+
 template <class Graph, class Vertex>
 class IShellIndex
 {
 public:
-    typedef std::map<typename Vertex::VertexId, unsigned int> ShellIndexContainer;
+    typedef std::map<typename Vertex::VertexId, typename ShellIndexValue<Vertex>::Type>
+        ShellIndexContainer;
     typedef AutonomousIterator<ShellIndexContainer> ShellIndexIterator;
 
     virtual ShellIndexIterator iterator() = 0;
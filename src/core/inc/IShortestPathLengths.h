@@ -0,0 +1,37 @@
+#pragma once
+
+#include <map>
+
+#include "mili/mili.h"
+
+namespace graphpp
+{
+template <class Graph, class Vertex>
+class IShortestPathLengths
+{
+public:
+    typedef typename Vertex::VertexId VertexId;
+    typedef std::map<VertexId, double> ClosenessContainer;
+    typedef AutonomousIterator<ClosenessContainer> ClosenessIterator;
+    // Number of ordered pairs of vertices at every distance, from 1 on.
+    typedef std::map<unsigned int, double> DistanceContainer;
+    typedef AutonomousIterator<DistanceContainer> DistanceIterator;
+
+    /**
+     * Closeness of every vertex: the number of vertices it reaches divided by the sum of
+     * their distances, so that it is the inverse of the mean distance to them and stays
+     * defined on disconnected graphs. Vertices that reach nothing have closeness 0.
+     */
+    virtual ClosenessIterator closenessIterator() = 0;
+
+    virtual DistanceIterator distanceIterator() = 0;
+
+    // Mean distance between the ordered pairs of distinct vertices joined by a path.
+    virtual double averagePathLength() const = 0;
+
+    // Longest distance between two vertices joined by a path.
+    virtual unsigned int diameter() const = 0;
+
+    virtual ~IShortestPathLengths() {}
+};
+}  // namespace graphpp
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "mili/mili.h"
+
+namespace graphpp
+{
+template <class Graph, class Vertex>
+class ITrussDecomposition
+{
+public:
+    typedef typename Vertex::VertexId VertexId;
+
+    struct Edge
+    {
+        VertexId from;
+        VertexId to;
+        unsigned int truss;
+    };
+
+    // One entry per edge, parallel edges and loops left out, with from < to.
+    typedef std::vector<Edge> TrussContainer;
+    typedef AutonomousIterator<TrussContainer> TrussIterator;
+
+    // Number of edges of every truss number.
+    typedef std::map<unsigned int, unsigned int> DistributionContainer;
+    typedef CAutonomousIterator<DistributionContainer> DistributionIterator;
+
+    virtual TrussIterator edgesIterator() = 0;
+
+    // Truss number of the edge between from and to, or 0 if there is no such edge.
+    virtual unsigned int trussNumber(VertexId from, VertexId to) = 0;
+
+    virtual DistributionIterator distribution() = 0;
+
+    virtual ~ITrussDecomposition() {}
+};
+}  // namespace graphpp
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace graphpp
+{
+/**
+ * Class: IndexedHeap
+ * ------------------
+ * Description: d-ary min-heap over the integers [0, n), each with a key. The position of every
+ * element in the heap is tracked, so the key of an element already in the heap can be
+ * decreased in O(log n), as needed by Dijkstra's algorithm and by peeling algorithms.
+ * Template Argument Key: Type of the keys, compared with <
+ * Template Argument Arity: Children per node; 4 keeps the heap shallow and cache friendly
+ */
+template <class Key, unsigned int Arity = 4>
+class IndexedHeap
+{
+public:
+    typedef unsigned int Index;
+
+    explicit IndexedHeap(Index n = 0) : keys(n), positions(n, ABSENT) {}
+
+    // Resizes the universe of elements to [0, n), emptying the heap.
+    void reset(Index n)
+    {
+        heap.clear();
+        keys.assign(n, Key());
+        positions.assign(n, ABSENT);
+    }
+
+    bool empty() const
+    {
+        return heap.empty();
+    }
+
+    std::size_t size() const
+    {
+        return heap.size();
+    }
+
+    bool contains(Index i) const
+    {
+        return positions[i] != ABSENT;
+    }
+
+    Key key(Index i) const
+    {
+        return keys[i];
+    }
+
+    // Element with the smallest key.
+    Index top() const
+    {
+        return heap.front();
+    }
+
+    // Adds i, which must not be in the heap, with the given key.
+    void push(Index i, Key key)
+    {
+        keys[i] = key;
+        positions[i] = heap.size();
+        heap.push_back(i);
+        siftUp(positions[i]);
+    }
+
+    // Lowers the key of i, which must be in the heap.
+    void decrease(Index i, Key key)
+    {
+        keys[i] = key;
+        siftUp(positions[i]);
+    }
+
+    // Removes and returns the element with the smallest key.
+    Index pop()
+    {
+        const Index top = heap.front();
+        positions[top] = ABSENT;
+        const Index last = heap.back();
+        heap.pop_back();
+        if (!heap.empty())
+        {
+            heap.front() = last;
+            positions[last] = 0;
+            siftDown(0);
+        }
+        return top;
+    }
+
+    // Removes every element, in time proportional to the elements left.
+    void clear()
+    {
+        for (const Index i : heap)
+            positions[i] = ABSENT;
+        heap.clear();
+    }
+
+private:
+    static const std::size_t ABSENT = std::numeric_limits<std::size_t>::max();
+
+    void siftUp(std::size_t position)
+    {
+        const Index element = heap[position];
+        while (position > 0)
+        {
+            const std::size_t parent = (position - 1) / Arity;
+            if (!(keys[element] < keys[heap[parent]]))
+                break;
+            place(heap[parent], position);
+            position = parent;
+        }
+        place(element, position);
+    }
+
+    void siftDown(std::size_t position)
+    {
+        const Index element = heap[position];
+        while (true)
+        {
+            const std::size_t first = position * Arity + 1;
+            if (first >= heap.size())
+                break;
+            const std::size_t last = std::min(first + Arity, heap.size());
+            std::size_t smallest = first;
+            for (std::size_t child = first + 1; child < last; ++child)
+                if (keys[heap[child]] < keys[heap[smallest]])
+                    smallest = child;
+            if (!(keys[heap[smallest]] < keys[element]))
+                break;
+            place(heap[smallest], position);
+            position = smallest;
+        }
+        place(element, position);
+    }
+
+    void place(Index element, std::size_t position)
+    {
+        heap[position] = element;
+        positions[element] = position;
+    }
+
+    std::vector<Index> heap;
+    std::vector<Key> keys;
+    std::vector<std::size_t> positions;
+};
+
+template <class Key, unsigned int Arity>
+const std::size_t IndexedHeap<Key, Arity>::ABSENT;
+}  // namespace graphpp
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "IMaxClique.h"
+#include "SetIntersection.h"
 #include "TraverserOrdered.h"
 #include "mili/mili.h"
 
+#include <algorithm>
 #include <time.h>
+#include <vector>
 
 namespace graphpp
 {
@@ -81,6 +84,7 @@ public:
 
     void visit(Vertex* v)
     {
+        sortedNeighbors(v);
         auto neighbors = v->neighborsIterator();
         while (!neighbors.end())
         {
@@ -102,20 +106,7 @@ public:
                         }
                         else
                         {
-                            NeighborsIterator iterator1 = v->neighborsIterator();
-                            while (!iterator1.end())
-                            {
-                                LIterator iterator2 = (*as[x])[i]->begin();
-                                while (iterator2 != (*as[x])[i]->end())
-                                {
-                                    if ((*iterator1)->getVertexId() == (*iterator2)->getVertexId())
-                                    {
-                                        L->insert(*iterator1);
-                                    }
-                                    iterator2++;
-                                }
-                                iterator1++;
-                            }
+                            intersectNeighbors(*(*as[x])[i], *L);
                             L->insert(v);
                         }
                         if (as[v] == nullptr)
@@ -196,6 +187,39 @@ public:
     }
 
 private:
+    typedef typename Vertex::VertexId VertexId;
+
+    // Keeps the distinct neighbors of v and their ids, sorted by id.
+    void sortedNeighbors(Vertex* v)
+    {
+        neighborsById.clear();
+        for (auto it = v->neighborsIterator(); !it.end(); it++)
+            neighborsById.push_back(*it);
+        std::sort(neighborsById.begin(), neighborsById.end(), [](Vertex* a, Vertex* b) {
+            return a->getVertexId() < b->getVertexId();
+        });
+        neighborsById.erase(
+            std::unique(neighborsById.begin(), neighborsById.end()), neighborsById.end());
+        neighborIds.clear();
+        for (Vertex* w : neighborsById)
+            neighborIds.push_back(w->getVertexId());
+    }
+
+    // Adds to L the neighbors of the vertex being visited that belong to candidates.
+    void intersectNeighbors(const LSet& candidates, LSet& L)
+    {
+        candidateIds.clear();
+        for (Vertex* w : candidates)
+            candidateIds.push_back(w->getVertexId());
+        std::sort(candidateIds.begin(), candidateIds.end());
+        SetIntersection::intersect(
+            neighborIds.data(), neighborIds.data() + neighborIds.size(), candidateIds.data(),
+            candidateIds.data() + candidateIds.size(),
+            [this, &L](const VertexId* found, const VertexId*) {
+                L.insert(neighborsById[found - neighborIds.data()]);
+            });
+    }
+
     void calculateMaxClique(Graph& graph)
     {
         MaxCliqueVisitor<Graph, Vertex> visitor(*this);
@@ -209,6 +233,9 @@ private:
     AttributeMap as;
     MaxCliqueContainer container;
     IntegerDistribution<Graph, Vertex, MaxCliqueMap<Graph, Vertex>> distribution;
+    std::vector<Vertex*> neighborsById;
+    std::vector<VertexId> neighborIds;
+    std::vector<VertexId> candidateIds;
 };
 
 //************************************ EXACT ********************************************//
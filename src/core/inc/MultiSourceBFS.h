@@ -0,0 +1,216 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace graphpp
+{
+/**
+ * Class: LaneMask
+ * ---------------
+ * Description: Set of BFS lanes (sources) packed in Words 64-bit words. The operations are
+ * plain loops over the words, which compilers turn into SSE/AVX OR and AND-NOT instructions
+ * for Words = 2 and 4.
+ */
+template <unsigned int Words>
+struct LaneMask
+{
+    uint64_t words[Words];
+
+    static LaneMask none()
+    {
+        LaneMask mask;
+        for (unsigned int i = 0; i < Words; ++i)
+            mask.words[i] = 0;
+        return mask;
+    }
+
+    static LaneMask single(unsigned int lane)
+    {
+        LaneMask mask = none();
+        mask.words[lane / 64] = uint64_t(1) << (lane % 64);
+        return mask;
+    }
+
+    bool any() const
+    {
+        uint64_t bits = 0;
+        for (unsigned int i = 0; i < Words; ++i)
+            bits |= words[i];
+        return bits != 0;
+    }
+
+    LaneMask operator&(const LaneMask& other) const
+    {
+        LaneMask mask;
+        for (unsigned int i = 0; i < Words; ++i)
+            mask.words[i] = words[i] & other.words[i];
+        return mask;
+    }
+
+    // Lanes of this mask that are not in other.
+    LaneMask andNot(const LaneMask& other) const
+    {
+        LaneMask mask;
+        for (unsigned int i = 0; i < Words; ++i)
+            mask.words[i] = words[i] & ~other.words[i];
+        return mask;
+    }
+
+    LaneMask& operator|=(const LaneMask& other)
+    {
+        for (unsigned int i = 0; i < Words; ++i)
+            words[i] |= other.words[i];
+        return *this;
+    }
+
+    unsigned int count() const
+    {
+        unsigned int bits = 0;
+        for (unsigned int i = 0; i < Words; ++i)
+            bits += __builtin_popcountll(words[i]);
+        return bits;
+    }
+
+    // Calls f(lane) for every lane in the mask, in increasing order.
+    template <class F>
+    void forEach(F f) const
+    {
+        for (unsigned int i = 0; i < Words; ++i)
+        {
+            for (uint64_t bits = words[i]; bits != 0; bits &= bits - 1)
+                f(i * 64 + __builtin_ctzll(bits));
+        }
+    }
+};
+
+/**
+ * Class: MultiSourceBFS
+ * ---------------------
+ * Description: Breadth first search from up to 64 * Words sources at once (Then et al.,
+ * "The more the merrier: efficient multi-source graph traversal", 2014). Every vertex keeps
+ * the set of sources that have already reached it, and a level is expanded by scanning the
+ * adjacency of each frontier vertex once for all the sources it carries, so the cost of the
+ * scans is shared by every source in the batch.
+ * The result of a run is the list of levels: level d holds one entry per vertex with the
+ * set of sources whose distance to it is d. Analyses read the levels to derive distances,
+ * path counts or dependencies.
+ * For directed graphs the search follows the out-adjacency.
+ */
+template <class Compact, unsigned int Words = 1>
+class MultiSourceBFS
+{
+public:
+    typedef typename Compact::Index Index;
+    typedef LaneMask<Words> Mask;
+    static const unsigned int LANES = 64 * Words;
+
+    struct Entry
+    {
+        Index vertex;
+        Mask sources;
+    };
+
+    explicit MultiSourceBFS(const Compact& graph)
+        : graph(graph),
+          seen(graph.verticesCount(), Mask::none()),
+          next(graph.verticesCount(), Mask::none())
+    {
+    }
+
+    /**
+     * Method: run
+     * -----------
+     * Description: Searches from sources[0..count), source i being lane i, up to the given
+     * depth.
+     * @param sources Indices of the sources
+     * @param count Number of sources, at most LANES
+     * @param depth Last level to reach; vertices farther from every source are left out
+     */
+    void run(
+        const Index* sources,
+        unsigned int count,
+        unsigned int depth = std::numeric_limits<unsigned int>::max())
+    {
+        for (const Entry& entry : entries)
+            seen[entry.vertex] = Mask::none();
+        entries.clear();
+        starts.assign(1, 0);
+
+        // Sources sharing a vertex share its entry.
+        for (unsigned int lane = 0; lane < count; ++lane)
+        {
+            if (!seen[sources[lane]].any())
+                entries.push_back(Entry{sources[lane], Mask::none()});
+            seen[sources[lane]] |= Mask::single(lane);
+        }
+        for (Entry& entry : entries)
+            entry.sources = seen[entry.vertex];
+        starts.push_back(entries.size());
+
+        while (starts.back() > starts[starts.size() - 2] && starts.size() - 2 < depth)
+        {
+            const std::size_t begin = starts[starts.size() - 2];
+            const std::size_t end = starts.back();
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                const Index v = entries[i].vertex;
+                const Mask frontier = entries[i].sources;
+                for (const Index* w = graph.neighborsBegin(v); w != graph.neighborsEnd(v); ++w)
+                {
+                    const Mask reached = frontier.andNot(seen[*w]);
+                    if (!reached.any())
+                        continue;
+                    if (!next[*w].any())
+                        touched.push_back(*w);
+                    next[*w] |= reached;
+                }
+            }
+
+            for (const Index w : touched)
+            {
+                seen[w] |= next[w];
+                entries.push_back(Entry{w, next[w]});
+                next[w] = Mask::none();
+            }
+            touched.clear();
+            starts.push_back(entries.size());
+        }
+        if (starts.back() == starts[starts.size() - 2])
+            starts.pop_back();
+    }
+
+    // Number of levels of the last run; level 0 holds the sources.
+    unsigned int levels() const
+    {
+        return starts.size() - 1;
+    }
+
+    const Entry* levelBegin(unsigned int level) const
+    {
+        return entries.data() + starts[level];
+    }
+
+    const Entry* levelEnd(unsigned int level) const
+    {
+        return entries.data() + starts[level + 1];
+    }
+
+    const Compact& compactGraph() const
+    {
+        return graph;
+    }
+
+private:
+    const Compact& graph;
+    std::vector<Mask> seen;
+    std::vector<Mask> next;
+    std::vector<Index> touched;
+    std::vector<Entry> entries;
+    std::vector<std::size_t> starts;
+};
+
+template <class Compact, unsigned int Words>
+const unsigned int MultiSourceBFS<Compact, Words>::LANES;
+}  // namespace graphpp
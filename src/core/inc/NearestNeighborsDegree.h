@@ -1,9 +1,19 @@
 #pragma once
 
+#include <vector>
+
+#include "CompactGraph.h"
 #include "INearestNeighborsDegree.h"
 
 namespace graphpp
 {
+/**
+ * Class: NearestNeighborsDegree
+ * -----------------------------
+ * Description: Mean degree of the neighbors of the vertices of an undirected graph. The whole
+ * graph is computed from a CompactGraph by degreeCorrelations, which also gives knn(k) and the
+ * degree assortativity.
+ */
 template <class Graph, class Vertex>
 class NearestNeighborsDegree : public INearestNeighborsDegree<Graph, Vertex>
 {
@@ -46,5 +56,22 @@ public:
 
         return v->degree() == 0 ? 0 : double(degreeSum) / v->degree();
     }
+
+    virtual DegreeCorrelations degreeCorrelations(Graph& g, unsigned int threads = 0)
+    {
+        typedef typename CompactGraph<Graph, Vertex>::Index Index;
+        const CompactGraph<Graph, Vertex> compact(g);
+        std::vector<std::size_t> keys(compact.verticesCount());
+        std::vector<double> degrees(keys.size());
+        for (Index v = 0; v < keys.size(); ++v)
+            degrees[v] = keys[v] = compact.degree(v);
+        return graphpp::degreeCorrelations(
+            keys, degrees,
+            [&](Index v, const auto& add) {
+                for (const Index* w = compact.neighborsBegin(v); w != compact.neighborsEnd(v); ++w)
+                    add(1.0, degrees[*w]);
+            },
+            threads);
+    }
 };
 }  // namespace graphpp
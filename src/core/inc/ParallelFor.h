@@ -0,0 +1,191 @@
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace graphpp
+{
+/**
+ * Class: ParallelFor
+ * ------------------
+ * Description: Runs the iterations of a loop over the range [0, count) on a pool of worker
+ * threads. The range is split evenly among the workers; a worker that runs out of iterations
+ * steals half of what is left to another worker, so a few expensive iterations (hubs, large
+ * components) do not leave the remaining threads idle.
+ */
+class ParallelFor
+{
+public:
+    typedef std::size_t Index;
+
+    /**
+     * Method: threadCount
+     * -------------------
+     * Description: Resolves the number of worker threads to use.
+     * @param requested Requested number of threads, 0 meaning one per available core
+     * @returns The number of threads to spawn, always at least 1
+     */
+    static unsigned int threadCount(unsigned int requested)
+    {
+        if (requested != 0)
+            return requested;
+
+        unsigned int cores = std::thread::hardware_concurrency();
+        return cores == 0 ? 1 : cores;
+    }
+
+    /**
+     * Method: run
+     * -----------
+     * Description: Calls body(thread, index) once for every index in [0, count). Each thread
+     * id in [0, threadCount(threads)) is used by exactly one worker, so it can be used to
+     * address per-thread scratch space and accumulators. Exceptions thrown by the body are
+     * rethrown in the calling thread once every worker has finished.
+     * @param count Number of iterations
+     * @param threads Requested number of threads, 0 meaning one per available core
+     * @param body Callable receiving the thread id and the iteration index
+     * @param grain Number of consecutive iterations a worker takes from its range at once
+     */
+    template <class Body>
+    static void run(Index count, unsigned int threads, Body body, Index grain = 1)
+    {
+        const unsigned int workers =
+            std::min<Index>(threadCount(threads), std::max<Index>(count, 1));
+        grain = std::max<Index>(grain, 1);
+
+        if (workers == 1)
+        {
+            for (Index i = 0; i < count; ++i)
+                body(0, i);
+            return;
+        }
+
+        std::vector<Range> ranges(workers);
+        for (unsigned int t = 0; t < workers; ++t)
+        {
+            ranges[t].begin = count * t / workers;
+            ranges[t].end = count * (t + 1) / workers;
+        }
+
+        std::exception_ptr failure;
+        std::mutex failureMutex;
+        auto worker = [&](unsigned int t) {
+            try
+            {
+                Index begin, end;
+                while (next(ranges, t, grain, begin, end))
+                    for (Index i = begin; i < end; ++i)
+                        body(t, i);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(failureMutex);
+                if (!failure)
+                    failure = std::current_exception();
+                // Leave nothing behind for the other workers to pick up.
+                for (auto& range : ranges)
+                {
+                    std::lock_guard<std::mutex> rangeLock(range.mutex);
+                    range.begin = range.end;
+                }
+            }
+        };
+
+        std::vector<std::thread> pool;
+        for (unsigned int t = 1; t < workers; ++t)
+            pool.emplace_back(worker, t);
+        worker(0);
+        for (auto& thread : pool)
+            thread.join();
+
+        if (failure)
+            std::rethrow_exception(failure);
+    }
+
+private:
+    // Pending iterations of a worker; padded to its own cache line.
+    struct alignas(64) Range
+    {
+        std::mutex mutex;
+        Index begin = 0;
+        Index end = 0;
+    };
+
+    // Takes the next block of iterations for worker t, stealing if its own range is empty.
+    static bool next(
+        std::vector<Range>& ranges,
+        unsigned int t,
+        Index grain,
+        Index& begin,
+        Index& end)
+    {
+        {
+            std::lock_guard<std::mutex> lock(ranges[t].mutex);
+            if (ranges[t].begin < ranges[t].end)
+            {
+                begin = ranges[t].begin;
+                end = std::min(ranges[t].end, begin + grain);
+                ranges[t].begin = end;
+                return true;
+            }
+        }
+
+        const unsigned int workers = ranges.size();
+        for (unsigned int offset = 1; offset < workers; ++offset)
+        {
+            Range& victim = ranges[(t + offset) % workers];
+            Index stolenBegin, stolenEnd;
+            {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                const Index left = victim.end - victim.begin;
+                if (left == 0)
+                    continue;
+                stolenEnd = victim.end;
+                stolenBegin = victim.end - (left + 1) / 2;
+                victim.end = stolenBegin;
+            }
+
+            begin = stolenBegin;
+            end = std::min(stolenEnd, begin + grain);
+            std::lock_guard<std::mutex> lock(ranges[t].mutex);
+            ranges[t].begin = end;
+            ranges[t].end = stolenEnd;
+            return true;
+        }
+
+        return false;
+    }
+};
+
+/**
+ * Function: vertexValues
+ * ----------------------
+ * Description: Computes a value for every vertex of a graph on the threads of ParallelFor.
+ * value(v) is called concurrently, so it must only read the graph.
+ * @param g Graph whose vertices to evaluate
+ * @param threads Requested number of threads, 0 meaning one per available core
+ * @param value Callable receiving a vertex and returning its value
+ * @returns The value of every vertex of g, in the order g iterates them
+ */
+template <class Vertex, class Graph, class Value>
+std::vector<double> vertexValues(Graph& g, unsigned int threads, Value value)
+{
+    std::vector<Vertex*> vertices;
+    auto it = g.verticesIterator();
+    while (!it.end())
+    {
+        vertices.push_back(*it);
+        ++it;
+    }
+    std::vector<double> values(vertices.size());
+    ParallelFor::run(
+        vertices.size(),
+        threads,
+        [&](unsigned int, std::size_t i) { values[i] = value(vertices[i]); },
+        16);
+    return values;
+}
+}  // namespace graphpp
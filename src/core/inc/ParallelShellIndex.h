@@ -0,0 +1,162 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <vector>
+
+#include "CompactGraph.h"
+#include "IShellIndex.h"
+#include "ParallelFor.h"
+#include "typedefs.h"
+
+namespace graphpp
+{
+// Smallest frontier or scan that parallelCoreNumbers spreads among threads.
+static const std::size_t PARALLEL_CORE_CUTOFF = 2048;
+
+/**
+ * Function: parallelCoreNumbers
+ * -----------------------------
+ * Description: Core numbers by level-synchronous peeling (Kabir and Madduri, "Parallel k-core
+ * decomposition on multicore platforms", 2017). For every level k, the vertices left with
+ * degree k form a frontier that is removed as a whole, all of it at once: its vertices are
+ * split among the threads, which decrement the degree of their neighbors atomically. The
+ * thread that takes a neighbor from k + 1 down to k adds it to the next frontier, and a
+ * decrement that would go below k is undone, so every vertex enters exactly one frontier and
+ * gets the level of that frontier as its core number. When a level is exhausted, the vertices
+ * still in the graph are compacted and the next level is their smallest degree.
+ * Frontiers and scans below PARALLEL_CORE_CUTOFF vertices run on the calling thread.
+ * @param graph Undirected graph to analyze
+ * @param threads Number of threads, 0 meaning one per available core
+ * @returns The core number of every vertex, indexed by vertex index
+ */
+template <class Compact>
+std::vector<unsigned int> parallelCoreNumbers(const Compact& graph, unsigned int threads)
+{
+    typedef typename Compact::Index Index;
+    typedef std::vector<std::vector<Index>> Buckets;
+    const unsigned int NONE = std::numeric_limits<unsigned int>::max();
+
+    const Index n = graph.verticesCount();
+    std::vector<std::atomic<unsigned int>> degree(n);
+    std::vector<unsigned int> core(n, NONE);
+    std::vector<Index> remaining(n);
+    for (Index v = 0; v < n; ++v)
+    {
+        degree[v].store(graph.degree(v), std::memory_order_relaxed);
+        remaining[v] = v;
+    }
+
+    // Calls body(chunk, begin, end) over a split of [0, size) into chunks, in parallel unless
+    // size is small.
+    const std::size_t chunks = std::size_t(ParallelFor::threadCount(threads)) * 8;
+    auto split = [&](std::size_t size, auto body) {
+        ParallelFor::run(
+            chunks, size < PARALLEL_CORE_CUTOFF ? 1 : threads, [&](unsigned int, std::size_t c) {
+                body(c, size * c / chunks, size * (c + 1) / chunks);
+            });
+    };
+    auto join = [](Buckets& buckets, std::vector<Index>& out) {
+        out.clear();
+        for (auto& bucket : buckets)
+        {
+            out.insert(out.end(), bucket.begin(), bucket.end());
+            bucket.clear();
+        }
+    };
+
+    Buckets buckets(chunks);
+    std::vector<unsigned int> minimum(chunks);
+    std::vector<Index> frontier;
+    unsigned int k = 0;
+    while (true)
+    {
+        // Drop the vertices already peeled and find the next level.
+        std::fill(minimum.begin(), minimum.end(), NONE);
+        split(remaining.size(), [&](std::size_t c, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                const Index v = remaining[i];
+                if (core[v] != NONE)
+                    continue;
+                buckets[c].push_back(v);
+                minimum[c] = std::min(minimum[c], degree[v].load(std::memory_order_relaxed));
+            }
+        });
+        join(buckets, remaining);
+        if (remaining.empty())
+            break;
+        k = std::max(k, *std::min_element(minimum.begin(), minimum.end()));
+
+        split(remaining.size(), [&](std::size_t c, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                const Index v = remaining[i];
+                if (degree[v].load(std::memory_order_relaxed) == k)
+                {
+                    core[v] = k;
+                    buckets[c].push_back(v);
+                }
+            }
+        });
+        join(buckets, frontier);
+
+        while (!frontier.empty())
+        {
+            split(frontier.size(), [&](std::size_t c, std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    const Index v = frontier[i];
+                    for (const Index* u = graph.neighborsBegin(v); u != graph.neighborsEnd(v);
+                         ++u)
+                    {
+                        if (degree[*u].load(std::memory_order_relaxed) <= k)
+                            continue;
+                        const unsigned int old = degree[*u].fetch_sub(1);
+                        if (old == k + 1)
+                        {
+                            core[*u] = k;
+                            buckets[c].push_back(*u);
+                        }
+                        else if (old <= k)
+                            degree[*u].fetch_add(1);
+                    }
+                }
+            });
+            join(buckets, frontier);
+        }
+    }
+    return core;
+}
+
+/**
+ * Class: ParallelShellIndex
+ * -------------------------
+ * Description: Shell index of every vertex of an undirected graph, computed by
+ * parallelCoreNumbers with the given number of threads. Gives the same values as ShellIndex.
+ */
+template <class Graph, class Vertex>
+class ParallelShellIndex : public IShellIndex<Graph, Vertex>
+{
+public:
+    typedef typename IShellIndex<Graph, Vertex>::ShellIndexContainer ShellIndexContainer;
+    typedef typename IShellIndex<Graph, Vertex>::ShellIndexIterator ShellIndexIterator;
+
+    ParallelShellIndex(Graph& g, unsigned int threads = 0)
+    {
+        const CompactGraph<Graph, Vertex> compact(g);
+        const std::vector<unsigned int> cores = parallelCoreNumbers(compact, threads);
+        for (unsigned int i = 0; i < compact.verticesCount(); ++i)
+            shellIndex[compact.vertex(i)->getVertexId()] = cores[i];
+    }
+
+    virtual ShellIndexIterator iterator()
+    {
+        return ShellIndexIterator(shellIndex);
+    }
+
+private:
+    ShellIndexContainer shellIndex;
+};
+}  // namespace graphpp
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define GRAPHPP_X86_INTERSECTION
+#include <immintrin.h>
+#endif
+
+namespace graphpp
+{
+/**
+ * Class: SetIntersection
+ * ----------------------
+ * Description: Kernels that intersect two sorted arrays of 32-bit integers, such as the rows of
+ * a CompactGraph, calling found(inA, inB) with the position of every common value in each
+ * array, by increasing value.
+ * - MERGE: scalar merge, O(|a| + |b|).
+ * - GALLOPING: exponential then binary search of every value of a in the rest of b,
+ *   O(|a| log(|b| / |a|)); the fastest when a is much shorter than b.
+ * - SSE: compares blocks of 4 values of a with all 4 rotations of a block of b, and skips the
+ *   block with the smaller last value (Schlegel et al., "Fast sorted-set intersection using
+ *   SIMD instructions", 2011; Lemire et al., "SIMD compression and the intersection of sorted
+ *   integers", 2016).
+ * - AVX2: the same with blocks of 8 values.
+ * The SIMD kernels are compiled for their instruction set only, so the binary keeps running on
+ * processors without it; intersect picks the kernel at runtime from the processor features and
+ * the lengths of the arrays. With repeated values, a common value may be reported more than
+ * once, but always in increasing order.
+ */
+class SetIntersection
+{
+public:
+    typedef unsigned int Value;
+
+    enum Kernel
+    {
+        MERGE,
+        GALLOPING,
+        SSE,
+        AVX2
+    };
+
+    // Length ratio beyond which intersect gallops through the longer array.
+    static const std::size_t GALLOPING_RATIO = 64;
+
+    // Whether the processor running the program supports the given kernel.
+    static bool available(Kernel kernel)
+    {
+#ifdef GRAPHPP_X86_INTERSECTION
+        static const bool sse = __builtin_cpu_supports("sse2");
+        static const bool avx2 = __builtin_cpu_supports("avx2");
+#else
+        static const bool sse = false;
+        static const bool avx2 = false;
+#endif
+        return kernel == MERGE || kernel == GALLOPING || (kernel == SSE && sse) ||
+               (kernel == AVX2 && avx2);
+    }
+
+    // Widest block kernel the processor supports, MERGE if none.
+    static Kernel blockKernel()
+    {
+        static const Kernel best = available(AVX2) ? AVX2 : available(SSE) ? SSE : MERGE;
+        return best;
+    }
+
+    /**
+     * Method: intersect
+     * -----------------
+     * Description: Intersects [a, aEnd) with [b, bEnd) using the given kernel, which must be
+     * available.
+     */
+    template <class Found>
+    static void intersect(
+        Kernel kernel, const Value* a, const Value* aEnd, const Value* b, const Value* bEnd,
+        Found found)
+    {
+        switch (kernel)
+        {
+            case GALLOPING:
+                gallop(a, aEnd, b, bEnd, found);
+                break;
+#ifdef GRAPHPP_X86_INTERSECTION
+            case SSE:
+                sse(a, aEnd, b, bEnd, found);
+                break;
+            case AVX2:
+                avx2(a, aEnd, b, bEnd, found);
+                break;
+#endif
+            default:
+                merge(a, aEnd, b, bEnd, found);
+        }
+    }
+
+    /**
+     * Method: intersect
+     * -----------------
+     * Description: Intersects [a, aEnd) with [b, bEnd), galloping through the longer array
+     * when the lengths differ by more than GALLOPING_RATIO and with blockKernel otherwise.
+     */
+    template <class Found>
+    static void intersect(
+        const Value* a, const Value* aEnd, const Value* b, const Value* bEnd, Found found)
+    {
+        const std::size_t m = aEnd - a;
+        const std::size_t n = bEnd - b;
+        if (m == 0 || n == 0)
+            return;
+        if (m * GALLOPING_RATIO < n)
+            gallop(a, aEnd, b, bEnd, found);
+        else if (n * GALLOPING_RATIO < m)
+            gallop(b, bEnd, a, aEnd, [&found](const Value* inB, const Value* inA) {
+                found(inA, inB);
+            });
+        else
+            intersect(blockKernel(), a, aEnd, b, bEnd, found);
+    }
+
+    // Number of common values of two sorted arrays without repeated values.
+    static std::size_t size(const Value* a, const Value* aEnd, const Value* b, const Value* bEnd)
+    {
+        std::size_t count = 0;
+        intersect(a, aEnd, b, bEnd, [&count](const Value*, const Value*) { ++count; });
+        return count;
+    }
+
+    template <class Found>
+    static void merge(
+        const Value* a, const Value* aEnd, const Value* b, const Value* bEnd, Found found)
+    {
+        while (a != aEnd && b != bEnd)
+        {
+            if (*a < *b)
+                ++a;
+            else if (*b < *a)
+                ++b;
+            else
+            {
+                found(a, b);
+                ++a;
+                ++b;
+            }
+        }
+    }
+
+    template <class Found>
+    static void gallop(
+        const Value* a, const Value* aEnd, const Value* b, const Value* bEnd, Found found)
+    {
+        for (; a != aEnd && b != bEnd; ++a)
+        {
+            // Doubles the step until b[step] >= *a, then searches the last step.
+            std::size_t step = 1;
+            while (step < std::size_t(bEnd - b) && b[step] < *a)
+                step *= 2;
+            b = std::lower_bound(b, b + std::min(step + 1, std::size_t(bEnd - b)), *a);
+            if (b != bEnd && *b == *a)
+                found(a, b);
+        }
+    }
+
+#ifdef GRAPHPP_X86_INTERSECTION
+    template <class Found>
+    __attribute__((target("sse2"))) static void sse(
+        const Value* a, const Value* aEnd, const Value* b, const Value* bEnd, Found found)
+    {
+        while (aEnd - a >= 4 && bEnd - b >= 4)
+        {
+            const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+            const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+            __m128i equal = _mm_cmpeq_epi32(va, vb);
+            equal = _mm_or_si128(
+                equal, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1))));
+            equal = _mm_or_si128(
+                equal, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+            equal = _mm_or_si128(
+                equal, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3))));
+            report(_mm_movemask_ps(_mm_castsi128_ps(equal)), a, b, found);
+            const Value aLast = a[3];
+            const Value bLast = b[3];
+            a += aLast <= bLast ? 4 : 0;
+            b += bLast <= aLast ? 4 : 0;
+        }
+        merge(a, aEnd, b, bEnd, found);
+    }
+
+    template <class Found>
+    __attribute__((target("avx2"))) static void avx2(
+        const Value* a, const Value* aEnd, const Value* b, const Value* bEnd, Found found)
+    {
+        const __m256i rotate = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+        while (aEnd - a >= 8 && bEnd - b >= 8)
+        {
+            const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a));
+            __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b));
+            __m256i equal = _mm256_cmpeq_epi32(va, vb);
+            for (int r = 1; r < 8; ++r)
+            {
+                vb = _mm256_permutevar8x32_epi32(vb, rotate);
+                equal = _mm256_or_si256(equal, _mm256_cmpeq_epi32(va, vb));
+            }
+            report(_mm256_movemask_ps(_mm256_castsi256_ps(equal)), a, b, found);
+            const Value aLast = a[7];
+            const Value bLast = b[7];
+            a += aLast <= bLast ? 8 : 0;
+            b += bLast <= aLast ? 8 : 0;
+        }
+        merge(a, aEnd, b, bEnd, found);
+    }
+
+private:
+    // Reports the values of the block of a flagged in mask, finding each in the block of b.
+    template <class Found>
+    static void report(int mask, const Value* a, const Value* b, Found& found)
+    {
+        while (mask != 0)
+        {
+            const int i = __builtin_ctz(mask);
+            mask &= mask - 1;
+            int j = 0;
+            while (b[j] != a[i])
+                ++j;
+            found(a + i, b + j);
+        }
+    }
+#endif
+};
+}  // namespace graphpp
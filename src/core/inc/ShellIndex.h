@@ -1,154 +1,114 @@
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
+#include "CompactGraph.h"
 #include "IShellIndex.h"
 #include "typedefs.h"
 
 namespace graphpp
 {
-typedef struct Node
-{
-    Vertex* vertex;
-    int currentDegree;
-} Node;
-
-template <class Graph, class Vertex>
-class ShellIndex : public IShellIndex<Graph, Vertex>
+/**
+ * Function: coreNumbers
+ * ---------------------
+ * Description: Shell index (core number) of every vertex, by the O(V + E) peeling algorithm of
+ * Batagelj and Zaversnik ("An O(m) algorithm for cores decomposition of networks", 2003).
+ * The vertices are kept in vert sorted by current degree, bin[d] being the position of the
+ * first one of degree d and pos[v] the position of v. Vertices are removed in that order, and
+ * a neighbor u of a removed vertex with a larger degree moves down one bucket by swapping
+ * places with the first vertex of its bucket, which keeps vert sorted in constant time.
+ * The degree of a vertex when it is removed is its core number. Parallel edges count once per
+ * copy, as in the degree of the vertex.
+ * @param graph Undirected graph to analyze
+ * @returns The core number of every vertex, indexed by vertex index
+ */
+template <class Compact>
+std::vector<unsigned int> coreNumbers(const Compact& graph)
 {
-public:
-    typedef typename IShellIndex<Graph, Vertex>::ShellIndexContainer ShellIndexContainer;
-    typedef typename IShellIndex<Graph, Vertex>::ShellIndexIterator ShellIndexIterator;
-
-    ShellIndex(Graph& g)
+    typedef typename Compact::Index Index;
+    const Index n = graph.verticesCount();
+    std::vector<unsigned int> degree(n);
+    unsigned int maximum = 0;
+    for (Index v = 0; v < n; ++v)
     {
-        totalVertexes = initMap(g);
-        initMultimapSet(g);
-        calculateShellIndex();
+        degree[v] = graph.degree(v);
+        maximum = std::max(maximum, degree[v]);
     }
 
-    virtual ShellIndexIterator iterator()
+    std::vector<Index> bin(maximum + 1, 0);
+    for (Index v = 0; v < n; ++v)
+        ++bin[degree[v]];
+    Index start = 0;
+    for (unsigned int d = 0; d <= maximum; ++d)
     {
-        return ShellIndexIterator(shellIndex);
+        const Index count = bin[d];
+        bin[d] = start;
+        start += count;
     }
 
-private:
-    Node* getNextNode()
+    std::vector<Index> pos(n);
+    std::vector<Index> vert(n);
+    for (Index v = 0; v < n; ++v)
     {
-        for (int i = 0; i < totalVertexes; i++)
-        {
-            if (!nodesByCurrentDegree[i].empty())
-            {
-                return nodesByCurrentDegree[i].front();
-            }
-        }
-        return nullptr;
+        pos[v] = bin[degree[v]]++;
+        vert[pos[v]] = v;
     }
+    // Shift the buckets back to their first positions.
+    for (unsigned int d = maximum; d > 0; --d)
+        bin[d] = bin[d - 1];
+    bin[0] = 0;
 
-    void calculateShellIndex()
+    for (Index i = 0; i < n; ++i)
     {
-        int k = 0;
-        // While there are remaining vertices in the graph
-        // Select the vertex with the lowest current degree
-        while (getNextNode() != nullptr)
+        const Index v = vert[i];
+        for (const Index* u = graph.neighborsBegin(v); u != graph.neighborsEnd(v); ++u)
         {
-            Node* nextVertex = getNextNode();
-            Vertex* v = nextVertex->vertex;
-            int degree = nextVertex->currentDegree;
-
-            // If the degree is higher than k, then we have a new higher k-core
-            // If lower, then it belongs to the actual k-core
-            if (degree > k)
+            if (degree[*u] <= degree[v])
+                continue;
+            const unsigned int d = degree[*u];
+            const Index first = bin[d];
+            const Index w = vert[first];
+            if (*u != w)
             {
-                k = degree;
-            }
-            // Setting the coreness as the current k.
-            shellIndex[v->getVertexId()] = k;
-            // Will mark it as removed from the structure, since the coreness is already calculated
-            nodesByVertexId[v->getVertexId()]->currentDegree = 0;
-            nodesByCurrentDegree[degree].remove(nextVertex);
-
-            NeighbourConstIterator neighborsIt = v->neighborsConstIterator();
-            // Iterate through each of it's neighbors to reduce their degree by 1, since v was
-            // removed.
-            while (!neighborsIt.end())
-            {
-                Vertex* neigh = *neighborsIt;
-                // Get the vertex node to be able to lower it one level in the structure
-                Node* neighNode = nodesByVertexId[neigh->getVertexId()];
-
-                if (neighNode->currentDegree > 0)
-                {
-                    // Remove it from the current level
-                    nodesByCurrentDegree[neighNode->currentDegree].remove(neighNode);
-                    neighNode->currentDegree--;
-
-                    if (neighNode->currentDegree > 0)
-                    {
-                        // Re add it to a lower level if it still has a valid degree
-                        nodesByCurrentDegree[neighNode->currentDegree].push_back(neighNode);
-                    }
-                    else
-                    {
-                        // Remove it and set coreness if the degree dropped to 0
-                        shellIndex[neighNode->vertex->getVertexId()] = k;
-                    }
-                }
-                ++neighborsIt;
+                std::swap(vert[pos[*u]], vert[first]);
+                pos[w] = pos[*u];
+                pos[*u] = first;
             }
+            ++bin[d];
+            --degree[*u];
         }
     }
+    return degree;
+}
+
+/**
+ * Class: ShellIndex
+ * -----------------
+ * Description: Shell index of every vertex of an undirected graph, computed by coreNumbers on
+ * a CompactGraph copy of it.
+ */
+template <class Graph, class Vertex>
+class ShellIndex : public IShellIndex<Graph, Vertex>
+{
+public:
+    typedef typename IShellIndex<Graph, Vertex>::ShellIndexContainer ShellIndexContainer;
+    typedef typename IShellIndex<Graph, Vertex>::ShellIndexIterator ShellIndexIterator;
 
-    int initMap(Graph& g)
+    ShellIndex(Graph& g)
     {
-        VerticesConstIterator it = g.verticesConstIterator();
-        int total = 0;
-
-        // initialize all elements in zero
-        while (!it.end())
-        {
-            Vertex* v = *it;
-            shellIndex.insert(
-                std::pair<typename Vertex::VertexId, unsigned int>(v->getVertexId(), 0));
-            ++it;
-            total++;
-        }
-        return total;
+        const CompactGraph<Graph, Vertex> compact(g);
+        const std::vector<unsigned int> cores = coreNumbers(compact);
+        for (unsigned int i = 0; i < compact.verticesCount(); ++i)
+            shellIndex[compact.vertex(i)->getVertexId()] = cores[i];
     }
 
-    void initMultimapSet(Graph& g)
+    virtual ShellIndexIterator iterator()
     {
-        VerticesConstIterator it = g.verticesConstIterator();
-        nodesByVertexId = new Node*[totalVertexes + 1];  // will not use index 0
-        nodesByCurrentDegree =
-            new std::list<Node*>[totalVertexes];  // 0 won't exist, still max degree possible is n-1
-
-        // initialize all elements using the vertex id and the vertex degree
-        while (!it.end())
-        {
-            Vertex* v = *it;
-            Node* newNode = new Node();
-            newNode->currentDegree = v->degree();
-            newNode->vertex = v;
-            nodesByVertexId[v->getVertexId()] = newNode;
-            nodesByCurrentDegree[v->degree()].push_back(newNode);
-            ++it;
-        }
+        return ShellIndexIterator(shellIndex);
     }
 
-    typedef typename Graph::VerticesConstIterator VerticesConstIterator;
-    typedef typename Vertex::VerticesConstIterator NeighbourConstIterator;
-
-    // This container will be set with the coreness of each vertex when found.
+private:
     ShellIndexContainer shellIndex;
-
-    // This structure represents an array of node pointers.
-    // This nodes are the different node-vertexes in the main structure
-    // The index of the array represents the id of the node.
-    // Used to get the node structure in O(1), to allow it to be moved to another list.
-    Node** nodesByVertexId;
-    // This is the main structure, contains an array of linked lists.
-    // The index of the array represents the current degree of the vertexes stored on that list.
-    // The lists are doubly-linked lists to allow a node representation to be easily removed.
-    std::list<Node*>* nodesByCurrentDegree;
-    int totalVertexes;
 };
 }  // namespace graphpp
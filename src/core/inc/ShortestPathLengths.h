@@ -0,0 +1,120 @@
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "CompactGraph.h"
+#include "IShortestPathLengths.h"
+#include "MultiSourceBFS.h"
+#include "ParallelFor.h"
+
+namespace graphpp
+{
+/**
+ * Class: ShortestPathLengths
+ * --------------------------
+ * Description: Hop distances between all ordered pairs of vertices, summarized as the
+ * closeness of every vertex and the distribution of the distances. Batches of 64 sources are
+ * searched together with a MultiSourceBFS and spread among the given number of threads.
+ * Directed graphs follow the edges in their direction, so the closeness of a vertex measures
+ * how close the rest of the graph is from it.
+ */
+template <class Graph, class Vertex>
+class ShortestPathLengths : public IShortestPathLengths<Graph, Vertex>
+{
+public:
+    typedef IShortestPathLengths<Graph, Vertex> Base;
+    typedef typename Base::ClosenessContainer ClosenessContainer;
+    typedef typename Base::ClosenessIterator ClosenessIterator;
+    typedef typename Base::DistanceContainer DistanceContainer;
+    typedef typename Base::DistanceIterator DistanceIterator;
+
+    ShortestPathLengths(Graph& g, unsigned int threads = 0) : pairs(0.0), total(0.0)
+    {
+        typedef CompactGraph<Graph, Vertex> Compact;
+        typedef MultiSourceBFS<Compact> Search;
+        typedef typename Search::Entry Entry;
+        const Compact compact(g);
+        const unsigned int n = compact.verticesCount();
+        const unsigned int batches = (n + Search::LANES - 1) / Search::LANES;
+
+        // Every source belongs to a single batch, so its sums are written by one thread.
+        std::vector<double> farness(n, 0.0);
+        std::vector<unsigned int> reached(n, 0);
+        std::vector<std::unique_ptr<Search>> searches(ParallelFor::threadCount(threads));
+        std::vector<std::vector<double>> counts(searches.size());
+
+        ParallelFor::run(batches, threads, [&](unsigned int thread, std::size_t b) {
+            if (!searches[thread])
+                searches[thread].reset(new Search(compact));
+            Search& search = *searches[thread];
+            std::vector<double>& count = counts[thread];
+
+            const unsigned int first = b * Search::LANES;
+            const unsigned int lanes = std::min(Search::LANES, n - first);
+            std::vector<typename Compact::Index> sources(lanes);
+            for (unsigned int lane = 0; lane < lanes; ++lane)
+                sources[lane] = first + lane;
+            search.run(sources.data(), lanes);
+
+            if (count.size() < search.levels())
+                count.resize(search.levels(), 0.0);
+            for (unsigned int d = 1; d < search.levels(); ++d)
+            {
+                for (const Entry* v = search.levelBegin(d); v != search.levelEnd(d); ++v)
+                {
+                    count[d] += v->sources.count();
+                    v->sources.forEach([&](unsigned int lane) {
+                        farness[first + lane] += d;
+                        ++reached[first + lane];
+                    });
+                }
+            }
+        });
+
+        for (const std::vector<double>& count : counts)
+        {
+            for (unsigned int d = 1; d < count.size(); ++d)
+            {
+                distances[d] += count[d];
+                pairs += count[d];
+                total += count[d] * d;
+            }
+        }
+
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            closeness[compact.vertex(i)->getVertexId()] =
+                reached[i] == 0 ? 0.0 : reached[i] / farness[i];
+        }
+    }
+
+    virtual ClosenessIterator closenessIterator()
+    {
+        return ClosenessIterator(closeness);
+    }
+
+    virtual DistanceIterator distanceIterator()
+    {
+        return DistanceIterator(distances);
+    }
+
+    virtual double averagePathLength() const
+    {
+        return pairs == 0.0 ? 0.0 : total / pairs;
+    }
+
+    virtual unsigned int diameter() const
+    {
+        return distances.empty() ? 0 : distances.rbegin()->first;
+    }
+
+private:
+    ClosenessContainer closeness;
+    DistanceContainer distances;
+    double pairs;
+    double total;
+};
+}  // namespace graphpp
@@ -0,0 +1,412 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "CompactGraph.h"
+#include "ITrussDecomposition.h"
+#include "ParallelFor.h"
+#include "SetIntersection.h"
+
+namespace graphpp
+{
+// Smallest frontier of edges that parallelTrussNumbers spreads among threads.
+static const std::size_t PARALLEL_TRUSS_CUTOFF = 256;
+
+/**
+ * Class: UndirectedEdges
+ * ----------------------
+ * Description: The edges of an undirected CompactGraph numbered 0..count()-1, each once, with
+ * parallel edges merged and loops left out. Every slot knows the number of its edge, so the
+ * triangles on an edge are found by intersecting the sorted rows of its endpoints.
+ */
+template <class Compact>
+class UndirectedEdges
+{
+public:
+    typedef typename Compact::Index Index;
+    static const Index NONE = std::numeric_limits<Index>::max();
+
+    explicit UndirectedEdges(const Compact& g) : graph(g), edges(g.slotsCount(), NONE)
+    {
+        const Index n = graph.verticesCount();
+        for (Index u = 0; u < n; ++u)
+        {
+            for (std::size_t s = graph.offset(u); s < graph.offset(u + 1); ++s)
+            {
+                const Index v = graph.target(s);
+                if (v <= u)
+                    continue;
+                if (s > graph.offset(u) && graph.target(s - 1) == v)
+                    edges[s] = edges[s - 1];
+                else
+                {
+                    edges[s] = ends.size();
+                    ends.push_back(std::make_pair(u, v));
+                }
+            }
+        }
+        for (Index u = 0; u < n; ++u)
+        {
+            for (std::size_t s = graph.offset(u); s < graph.offset(u + 1); ++s)
+            {
+                if (graph.target(s) < u)
+                    edges[s] = edges[graph.slot(graph.target(s), u)];
+            }
+        }
+    }
+
+    Index count() const
+    {
+        return ends.size();
+    }
+
+    // Endpoints of edge e, the smaller index first.
+    const std::pair<Index, Index>& endpoints(Index e) const
+    {
+        return ends[e];
+    }
+
+    // Edge of the given slot, or NONE for loops.
+    Index edgeOf(std::size_t slot) const
+    {
+        return edges[slot];
+    }
+
+    /**
+     * Method: triangles
+     * -----------------
+     * Description: Calls found(uw, vw) for every common neighbor w of the endpoints u and v of
+     * edge e, with the edges joining w to each of them. The rows of u and v are intersected by
+     * SetIntersection; parallel edges share their edge, so repeated neighbors are skipped.
+     */
+    template <class Found>
+    void triangles(Index e, Found found) const
+    {
+        const Index u = ends[e].first;
+        const Index v = ends[e].second;
+        const Index* uRow = graph.neighborsBegin(u);
+        const Index* vRow = graph.neighborsBegin(v);
+        Index last = NONE;
+        SetIntersection::intersect(
+            uRow, graph.neighborsEnd(u), vRow, graph.neighborsEnd(v),
+            [&](const Index* a, const Index* b) {
+                const Index w = *a;
+                if (w == last || w == u || w == v)
+                    return;
+                last = w;
+                found(
+                    edges[graph.offset(u) + (a - uRow)], edges[graph.offset(v) + (b - vRow)]);
+            });
+    }
+
+private:
+    const Compact& graph;
+    std::vector<Index> edges;
+    std::vector<std::pair<Index, Index>> ends;
+};
+
+template <class Compact>
+const typename UndirectedEdges<Compact>::Index UndirectedEdges<Compact>::NONE;
+
+/**
+ * Function: triangleSupport
+ * -------------------------
+ * Description: Number of triangles on every edge, counted in parallel over the edges.
+ */
+template <class Compact>
+std::vector<unsigned int> triangleSupport(
+    const UndirectedEdges<Compact>& edges, unsigned int threads)
+{
+    std::vector<unsigned int> support(edges.count());
+    ParallelFor::run(
+        edges.count(),
+        threads,
+        [&](unsigned int, std::size_t e) {
+            unsigned int count = 0;
+            edges.triangles(e, [&count](unsigned int, unsigned int) { ++count; });
+            support[e] = count;
+        },
+        64);
+    return support;
+}
+
+/**
+ * Function: sequentialTrussNumbers
+ * --------------------------------
+ * Description: Truss numbers by peeling the edges in order of support with a bucket queue,
+ * as coreNumbers does with vertices. Removing an edge takes one triangle from each of the
+ * other two edges of every triangle it still closes; the support of an edge when it is removed
+ * is its truss number minus two.
+ */
+template <class Compact>
+std::vector<unsigned int> sequentialTrussNumbers(
+    const UndirectedEdges<Compact>& edges, std::vector<unsigned int> support)
+{
+    typedef typename Compact::Index Index;
+    const Index m = edges.count();
+    unsigned int maximum = 0;
+    for (Index e = 0; e < m; ++e)
+        maximum = std::max(maximum, support[e]);
+
+    std::vector<Index> bin(maximum + 1, 0);
+    for (Index e = 0; e < m; ++e)
+        ++bin[support[e]];
+    Index start = 0;
+    for (unsigned int s = 0; s <= maximum; ++s)
+    {
+        const Index count = bin[s];
+        bin[s] = start;
+        start += count;
+    }
+    std::vector<Index> pos(m);
+    std::vector<Index> sorted(m);
+    for (Index e = 0; e < m; ++e)
+    {
+        pos[e] = bin[support[e]]++;
+        sorted[pos[e]] = e;
+    }
+    for (unsigned int s = maximum; s > 0; --s)
+        bin[s] = bin[s - 1];
+    bin[0] = 0;
+
+    std::vector<bool> removed(m, false);
+    auto lower = [&](Index f, unsigned int level) {
+        if (support[f] <= level)
+            return;
+        const unsigned int s = support[f];
+        const Index first = bin[s];
+        const Index g = sorted[first];
+        if (f != g)
+        {
+            std::swap(sorted[pos[f]], sorted[first]);
+            pos[g] = pos[f];
+            pos[f] = first;
+        }
+        ++bin[s];
+        --support[f];
+    };
+    for (Index i = 0; i < m; ++i)
+    {
+        const Index e = sorted[i];
+        removed[e] = true;
+        edges.triangles(e, [&](Index uw, Index vw) {
+            if (removed[uw] || removed[vw])
+                return;
+            lower(uw, support[e]);
+            lower(vw, support[e]);
+        });
+    }
+
+    for (Index e = 0; e < m; ++e)
+        support[e] += 2;
+    return support;
+}
+
+/**
+ * Function: parallelTrussNumbers
+ * ------------------------------
+ * Description: Truss numbers by level-synchronous peeling (Kabir and Madduri, "Shared-memory
+ * graph truss decomposition", 2017), the edge counterpart of parallelCoreNumbers. The edges
+ * left with support k form a frontier whose triangles are removed in parallel, decrementing
+ * the support of the other two edges atomically without going below k. A triangle with two
+ * edges in the frontier is only removed by the one with the smaller number, and one with all
+ * three in it needs no update. Frontiers below cutoff edges run on the calling thread.
+ */
+template <class Compact>
+std::vector<unsigned int> parallelTrussNumbers(
+    const UndirectedEdges<Compact>& edges,
+    const std::vector<unsigned int>& initial,
+    unsigned int threads,
+    std::size_t cutoff = PARALLEL_TRUSS_CUTOFF)
+{
+    typedef typename Compact::Index Index;
+    typedef std::vector<std::vector<Index>> Buckets;
+    enum State : unsigned char
+    {
+        ALIVE,
+        FRONTIER,
+        REMOVED
+    };
+    const unsigned int NONE = std::numeric_limits<unsigned int>::max();
+
+    const Index m = edges.count();
+    std::vector<std::atomic<unsigned int>> support(m);
+    std::vector<unsigned int> truss(m, NONE);
+    std::vector<unsigned char> state(m, ALIVE);
+    std::vector<Index> remaining(m);
+    for (Index e = 0; e < m; ++e)
+    {
+        support[e].store(initial[e], std::memory_order_relaxed);
+        remaining[e] = e;
+    }
+
+    const std::size_t chunks = std::size_t(ParallelFor::threadCount(threads)) * 8;
+    auto split = [&](std::size_t size, auto body) {
+        ParallelFor::run(
+            chunks, size < cutoff ? 1 : threads, [&](unsigned int, std::size_t c) {
+                body(c, size * c / chunks, size * (c + 1) / chunks);
+            });
+    };
+    auto join = [](Buckets& buckets, std::vector<Index>& out) {
+        out.clear();
+        for (auto& bucket : buckets)
+        {
+            out.insert(out.end(), bucket.begin(), bucket.end());
+            bucket.clear();
+        }
+    };
+
+    Buckets buckets(chunks);
+    std::vector<Index> frontier;
+    unsigned int k = 0;
+    while (true)
+    {
+        remaining.erase(
+            std::remove_if(
+                remaining.begin(),
+                remaining.end(),
+                [&](Index e) { return truss[e] != NONE; }),
+            remaining.end());
+        if (remaining.empty())
+            break;
+        unsigned int minimum = NONE;
+        for (const Index e : remaining)
+            minimum = std::min(minimum, support[e].load(std::memory_order_relaxed));
+        k = std::max(k, minimum);
+        for (const Index e : remaining)
+        {
+            if (support[e].load(std::memory_order_relaxed) == k)
+            {
+                truss[e] = k + 2;
+                frontier.push_back(e);
+            }
+        }
+
+        while (!frontier.empty())
+        {
+            for (const Index e : frontier)
+                state[e] = FRONTIER;
+            split(frontier.size(), [&](std::size_t c, std::size_t begin, std::size_t end) {
+                auto lower = [&](Index f) {
+                    if (support[f].load(std::memory_order_relaxed) <= k)
+                        return;
+                    const unsigned int old = support[f].fetch_sub(1);
+                    if (old == k + 1)
+                    {
+                        truss[f] = k + 2;
+                        buckets[c].push_back(f);
+                    }
+                    else if (old <= k)
+                        support[f].fetch_add(1);
+                };
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    const Index e = frontier[i];
+                    edges.triangles(e, [&](Index uw, Index vw) {
+                        if (state[uw] == REMOVED || state[vw] == REMOVED)
+                            return;
+                        if (state[uw] == ALIVE && state[vw] == ALIVE)
+                        {
+                            lower(uw);
+                            lower(vw);
+                        }
+                        else if (state[uw] == ALIVE && e < vw)
+                            lower(uw);
+                        else if (state[vw] == ALIVE && e < uw)
+                            lower(vw);
+                    });
+                }
+            });
+            for (const Index e : frontier)
+                state[e] = REMOVED;
+            join(buckets, frontier);
+        }
+    }
+    return truss;
+}
+
+/**
+ * Function: trussNumbers
+ * ----------------------
+ * Description: Truss number of every edge: the largest k such that the edge belongs to the
+ * k-truss, the largest subgraph where every edge closes at least k - 2 triangles. Edges in no
+ * triangle have truss number 2. The triangles on every edge are counted in parallel, and the
+ * edges are then peeled by sequentialTrussNumbers, or by parallelTrussNumbers when more than
+ * one thread is used.
+ * @param edges Edges of the undirected graph to analyze
+ * @param threads Number of threads, 0 meaning one per available core
+ * @returns The truss number of every edge, indexed by edge number
+ */
+template <class Compact>
+std::vector<unsigned int> trussNumbers(const UndirectedEdges<Compact>& edges, unsigned int threads)
+{
+    std::vector<unsigned int> support = triangleSupport(edges, threads);
+    if (ParallelFor::threadCount(threads) > 1)
+        return parallelTrussNumbers(edges, support, threads);
+    return sequentialTrussNumbers(edges, std::move(support));
+}
+
+/**
+ * Class: TrussDecomposition
+ * -------------------------
+ * Description: Truss number of every edge of an undirected graph, computed by trussNumbers on
+ * a CompactGraph copy of it, and the number of edges of every truss number. Edge weights and
+ * parallel edges are ignored.
+ */
+template <class Graph, class Vertex>
+class TrussDecomposition : public ITrussDecomposition<Graph, Vertex>
+{
+public:
+    typedef typename ITrussDecomposition<Graph, Vertex>::VertexId VertexId;
+    typedef typename ITrussDecomposition<Graph, Vertex>::Edge Edge;
+    typedef typename ITrussDecomposition<Graph, Vertex>::TrussContainer TrussContainer;
+    typedef typename ITrussDecomposition<Graph, Vertex>::TrussIterator TrussIterator;
+    typedef typename ITrussDecomposition<Graph, Vertex>::DistributionContainer
+        DistributionContainer;
+    typedef typename ITrussDecomposition<Graph, Vertex>::DistributionIterator
+        DistributionIterator;
+
+    TrussDecomposition(Graph& g, unsigned int threads = 0)
+    {
+        typedef CompactGraph<Graph, Vertex> Compact;
+        const Compact compact(g);
+        const UndirectedEdges<Compact> edges(compact);
+        const std::vector<unsigned int> values = trussNumbers(edges, threads);
+        for (typename Compact::Index e = 0; e < edges.count(); ++e)
+        {
+            VertexId from = compact.vertex(edges.endpoints(e).first)->getVertexId();
+            VertexId to = compact.vertex(edges.endpoints(e).second)->getVertexId();
+            if (to < from)
+                std::swap(from, to);
+            truss.push_back(Edge{from, to, values[e]});
+            indices[std::make_pair(from, to)] = e;
+            ++counts[values[e]];
+        }
+    }
+
+    virtual TrussIterator edgesIterator()
+    {
+        return TrussIterator(truss);
+    }
+
+    virtual unsigned int trussNumber(VertexId from, VertexId to)
+    {
+        const auto found = indices.find(std::make_pair(std::min(from, to), std::max(from, to)));
+        return found == indices.end() ? 0 : truss[found->second].truss;
+    }
+
+    virtual DistributionIterator distribution()
+    {
+        return DistributionIterator(counts);
+    }
+
+private:
+    TrussContainer truss;
+    std::map<std::pair<VertexId, VertexId>, std::size_t> indices;
+    DistributionContainer counts;
+};
+}  // namespace graphpp
@@ -1,19 +1,61 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "CompactGraph.h"
 #include "IClusteringCoefficient.h"
+#include "SetIntersection.h"
+#include "TriangleCounting.h"
 
 namespace graphpp
 {
+/**
+ * Class: WeightedClusteringCoefficient
+ * ------------------------------------
+ * Description: Clustering coefficient of the vertices of an undirected weighted graph, by
+ * Barrat's definition or by Onnela's (see WeightedClustering).
+ * The coefficients of the whole graph are computed in parallel by weightedLocalClustering; a
+ * single vertex intersects the weight maps of its neighbors, which are sorted by vertex id,
+ * with its own. Onnela's definition divides the weights by the largest one: the methods that
+ * take the graph use its largest weight, while vertexClusteringCoefficient uses the one given
+ * to the constructor, or the largest of the graph given to it when it was built.
+ */
 template <class Graph, class Vertex>
 class WeightedClusteringCoefficient : public IClusteringCoefficient<Graph, Vertex>
 {
 public:
+    // Barrat's definition, which needs no largest weight.
+    WeightedClusteringCoefficient() : definition(BARRAT), maxWeight(1.0) {}
+
+    /**
+     * @param definition Definition of the weighted clustering coefficient
+     * @param maxWeight Largest edge weight, by which vertexClusteringCoefficient divides the
+     * weights with Onnela's definition
+     */
+    WeightedClusteringCoefficient(WeightedClustering definition, double maxWeight)
+        : definition(definition), maxWeight(maxWeight)
+    {
+    }
+
+    /**
+     * @param g Graph whose largest edge weight vertexClusteringCoefficient divides the weights
+     * by with Onnela's definition, taken when this is built
+     * @param definition Definition of the weighted clustering coefficient
+     */
+    WeightedClusteringCoefficient(Graph& g, WeightedClustering definition)
+        : definition(definition), maxWeight(definition == ONNELA ? largestWeight(g) : 1.0)
+    {
+    }
+
     // TODO check if this method is implemented correctly
     virtual double clusteringCoefficient(Graph& g, unsigned int d)
     {
         auto it = g.verticesIterator();
         unsigned int count = 0;
         double clusteringCoefSums = 0.0;
+        const double maximum = definition == ONNELA ? largestWeight(g) : maxWeight;
 
         while (!it.end())
         {
@@ -22,7 +64,7 @@ public:
             if (v->degree() == d)
             {
                 ++count;
-                clusteringCoefSums += vertexClusteringCoefficient(v);
+                clusteringCoefSums += coefficient(v, maximum);
             }
 
             ++it;
@@ -33,34 +75,100 @@ public:
 
     virtual double vertexClusteringCoefficient(Vertex* vertex)
     {
-        double links = 0.0;
-        auto it = vertex->neighborsIterator();
-        double ret;
+        return coefficient(vertex, maxWeight);
+    }
 
-        while (!it.end())
+    virtual std::vector<double> vertexClusteringCoefficients(Graph& g, unsigned int threads = 0)
+    {
+        const CompactGraph<Graph, Vertex> compact(g);
+        return weightedLocalClustering(compact, definition, threads);
+    }
+
+private:
+    typedef typename Vertex::VertexId VertexId;
+
+    WeightedClustering definition;
+    double maxWeight;
+
+    // Neighbors of a vertex other than itself and the weights of their edges, by vertex id.
+    struct Neighborhood
+    {
+        std::vector<VertexId> ids;
+        std::vector<double> weights;
+    };
+
+    // Fills the neighborhood of v from its weight map, returning its strength.
+    static double neighborhood(Vertex* v, Neighborhood& neighbors)
+    {
+        neighbors.ids.clear();
+        neighbors.weights.clear();
+        double strength = 0.0;
+        auto it = v->weightsIterator();
+        for (; !it.end(); ++it)
         {
-            Vertex* n = static_cast<Vertex*>(*it);
+            strength += it->second;
+            if (it->first == v->getVertexId())
+                continue;
+            neighbors.ids.push_back(it->first);
+            neighbors.weights.push_back(it->second);
+        }
+        return strength;
+    }
 
-            auto innerIter = n->neighborsIterator();
+    double coefficient(Vertex* vertex, double maximum) const
+    {
+        Neighborhood own;
+        const double strength = neighborhood(vertex, own);
+        const double k = vertex->degree();
+        if (k < 2 || strength == 0.0)
+            return 0;
 
-            while (!innerIter.end())
-            {
-                Vertex* i = static_cast<Vertex*>(*innerIter);
-                // if i is neighbour of vertex, we close a triangle
-                if (i->isNeighbourOf(vertex))
-                    links += (vertex->edgeWeight(n) + i->edgeWeight(vertex)) / 2.0;
+        // The neighbor vertices, in the order of their ids in the weight map.
+        std::vector<Vertex*> neighbors;
+        auto it = vertex->neighborsIterator();
+        for (; !it.end(); ++it)
+        {
+            if (*it != vertex)
+                neighbors.push_back(static_cast<Vertex*>(*it));
+        }
+        std::sort(neighbors.begin(), neighbors.end(), [](Vertex* a, Vertex* b) {
+            return a->getVertexId() < b->getVertexId();
+        });
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
 
-                ++innerIter;
-            }
-            ++it;
+        Neighborhood theirs;
+        double links = 0.0;
+        for (std::size_t j = 0; j < neighbors.size() && j < own.ids.size(); ++j)
+        {
+            neighborhood(neighbors[j], theirs);
+            SetIntersection::intersect(
+                own.ids.data(), own.ids.data() + own.ids.size(), theirs.ids.data(),
+                theirs.ids.data() + theirs.ids.size(),
+                [&](const VertexId* inOwn, const VertexId* inTheirs) {
+                    const double ij = own.weights[j];
+                    const double ih = own.weights[inOwn - own.ids.data()];
+                    if (definition == BARRAT)
+                        links += (ij + ih) / 2.0;
+                    else
+                        links += std::cbrt(ij * ih * theirs.weights[inTheirs - theirs.ids.data()]) /
+                                 maximum;
+                });
         }
 
-        if (vertex->degree() == 1 || vertex->strength() == 0)
-            ret = 0;
-        else
-            ret = links / (vertex->strength() * (vertex->degree() - 1));
+        return definition == BARRAT ? links / (strength * (k - 1)) : links / (k * (k - 1));
+    }
 
-        return ret;
+    static double largestWeight(Graph& g)
+    {
+        double largest = 0.0;
+        auto it = g.verticesIterator();
+        for (; !it.end(); ++it)
+        {
+            auto weights = (*it)->weightsIterator();
+            for (; !weights.end(); ++weights)
+                largest = std::max(largest, weights->second);
+        }
+        return largest == 0.0 ? 1.0 : largest;
     }
 };
 }  // namespace graphpp
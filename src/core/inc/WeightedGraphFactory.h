@@ -1,13 +1,18 @@
 #pragma once
 
 #include "Betweenness.h"
+#include "BoundedBetweenness.h"
+#include "CheckpointedBetweenness.h"
 #include "IBetweenness.h"
+#include "EdgeBetweenness.h"
 #include "IGraphFactory.h"
 #include "StrengthDistribution.h"
+#include "TrussDecomposition.h"
 #include "WeightedBetweenness.h"
 #include "WeightedClusteringCoefficient.h"
 #include "WeightedGraphReader.h"
 #include "WeightedNearestNeighborsDegree.h"
+#include "WeightedShellIndex.h"
 
 namespace graphpp
 {
@@ -19,21 +24,69 @@ public:
     {
         return new WeightedGraphReader<Graph, Vertex>();
     }
-    virtual IBetweenness<Graph, Vertex>* createBetweenness(Graph& g)
+    virtual IBetweenness<Graph, Vertex>* createBetweenness(Graph& g, unsigned int threads = 0)
     {
-        return new WeightedBetweenness<Graph, Vertex>(g);
+        return new WeightedBetweenness<Graph, Vertex>(g, threads);
+    }
+    virtual IBetweenness<Graph, Vertex>* createCheckpointedBetweenness(
+        Graph& g, const std::string& path, double interval, unsigned int threads = 0)
+    {
+        return new CheckpointedBetweenness<Graph, Vertex>(g, path, interval, threads);
+    }
+    virtual IBetweenness<Graph, Vertex>* createBoundedBetweenness(
+        Graph& g, double k, unsigned int threads = 0)
+    {
+        return new BoundedBetweenness<Graph, Vertex>(g, k, threads);
+    }
+    virtual IEdgeBetweenness<Graph, Vertex>* createEdgeBetweenness(
+        Graph& g, unsigned int threads = 0)
+    {
+        return new EdgeBetweenness<Graph, Vertex>(g, threads);
+    }
+    virtual IBetweenness<Graph, Vertex>* createApproximateBetweenness(
+        Graph&, double, double, double, unsigned int = 0)
+    {
+        return nullptr;
     }
     virtual IClusteringCoefficient<Graph, Vertex>* createClusteringCoefficient()
     {
         return new WeightedClusteringCoefficient<Graph, Vertex>();
     }
+    // Weighted clustering coefficient of g by the given definition.
+    IClusteringCoefficient<Graph, Vertex>* createClusteringCoefficient(
+        Graph& g, WeightedClustering definition)
+    {
+        return new WeightedClusteringCoefficient<Graph, Vertex>(g, definition);
+    }
+    virtual IClusteringCoefficient<Graph, Vertex>* createApproximateClusteringCoefficient(
+        double, double, std::size_t)
+    {
+        return nullptr;
+    }
     virtual INearestNeighborsDegree<Graph, Vertex>* createNearestNeighborsDegree()
     {
         return new WeightedNearestNeighborsDegree<Graph, Vertex>();
     }
-    virtual IShellIndex<Graph, Vertex>* createShellIndex(Graph&)
+    virtual IShellIndex<Graph, Vertex>* createShellIndex(Graph& g)
+    {
+        return new WeightedShellIndex<Graph, Vertex>(g);
+    }
+    virtual IShellIndex<Graph, Vertex>* createParallelShellIndex(Graph&, unsigned int = 0)
+    {
+        return nullptr;
+    }
+    virtual ITrussDecomposition<Graph, Vertex>* createTrussDecomposition(
+        Graph& g, unsigned int threads = 0)
+    {
+        return new TrussDecomposition<Graph, Vertex>(g, threads);
+    }
+    virtual IDCoreDecomposition<Graph, Vertex>* createDCoreDecomposition(Graph&)
+    {
+        return nullptr;
+    }
+    virtual IShortestPathLengths<Graph, Vertex>* createShortestPathLengths(
+        Graph&, unsigned int = 0)
     {
-        // return new WeightedShellIndex<Graph,Vertex>();
         return nullptr;
     }
     virtual IDegreeDistribution<Graph, Vertex>* createDegreeDistribution(Graph& g)
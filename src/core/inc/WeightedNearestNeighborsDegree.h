@@ -1,9 +1,20 @@
 #pragma once
 
+#include <vector>
+
+#include "CompactGraph.h"
 #include "INearestNeighborsDegree.h"
 
 namespace graphpp
 {
+/**
+ * Class: WeightedNearestNeighborsDegree
+ * -------------------------------------
+ * Description: Mean degree of the neighbors of the vertices of an undirected weighted graph,
+ * each weighted by the weight of its edge and divided by the strength of the vertex. The whole
+ * graph is computed from a CompactGraph by degreeCorrelations, which also gives knn(k) and the
+ * weighted degree assortativity.
+ */
 template <class Graph, class Vertex>
 class WeightedNearestNeighborsDegree : public INearestNeighborsDegree<Graph, Vertex>
 {
@@ -46,5 +57,22 @@ public:
 
         return v->strength() == 0 ? 0 : double(degreeSum) / v->strength();
     }
+
+    virtual DegreeCorrelations degreeCorrelations(Graph& g, unsigned int threads = 0)
+    {
+        typedef typename CompactGraph<Graph, Vertex>::Index Index;
+        const CompactGraph<Graph, Vertex> compact(g);
+        std::vector<std::size_t> keys(compact.verticesCount());
+        std::vector<double> degrees(keys.size());
+        for (Index v = 0; v < keys.size(); ++v)
+            degrees[v] = keys[v] = compact.degree(v);
+        return graphpp::degreeCorrelations(
+            keys, degrees,
+            [&](Index v, const auto& add) {
+                for (std::size_t e = compact.offset(v); e < compact.offset(v + 1); ++e)
+                    add(compact.weight(e), degrees[compact.target(e)]);
+            },
+            threads);
+    }
 };
 }  // namespace graphpp
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "CompactGraph.h"
+#include "IShellIndex.h"
+#include "IndexedHeap.h"
+#include "typedefs.h"
+
+namespace graphpp
+{
+/**
+ * Function: strengthCoreNumbers
+ * -----------------------------
+ * Description: s-core number of every vertex of a weighted graph (Eidsaa and Almaas,
+ * "s-core network decomposition: a generalization of k-core analysis to weighted networks",
+ * 2013). The s-core is the largest subgraph where every vertex has strength, the sum of the
+ * weights of its edges within the subgraph, at least s; the s-core number of a vertex is the
+ * largest s whose s-core holds it.
+ * Vertices are removed in order of current strength, kept in an IndexedHeap: removing a vertex
+ * lowers the strength of its neighbors by the weights of the edges to it. The s-core number of
+ * a vertex is the largest strength seen at removal up to its own, which makes the whole
+ * decomposition O((V + E) log V). With unit weights it gives the core numbers.
+ * @param graph Undirected weighted graph to analyze, with non-negative weights
+ * @returns The s-core number of every vertex, indexed by vertex index
+ */
+template <class Compact>
+std::vector<double> strengthCoreNumbers(const Compact& graph)
+{
+    typedef typename Compact::Index Index;
+    const Index n = graph.verticesCount();
+    IndexedHeap<double> heap(n);
+    for (Index v = 0; v < n; ++v)
+    {
+        double strength = 0.0;
+        for (std::size_t s = graph.offset(v); s < graph.offset(v + 1); ++s)
+            strength += graph.weight(s);
+        heap.push(v, strength);
+    }
+
+    std::vector<double> core(n);
+    double level = 0.0;
+    while (!heap.empty())
+    {
+        const Index v = heap.top();
+        level = std::max(level, heap.key(v));
+        core[v] = level;
+        heap.pop();
+        for (std::size_t s = graph.offset(v); s < graph.offset(v + 1); ++s)
+        {
+            const Index w = graph.target(s);
+            if (heap.contains(w))
+                heap.decrease(w, heap.key(w) - graph.weight(s));
+        }
+    }
+    return core;
+}
+
+/**
+ * Class: WeightedShellIndex
+ * -------------------------
+ * Description: s-core number of every vertex of a weighted graph, computed by
+ * strengthCoreNumbers on a CompactGraph copy of it. It is the shell index of weighted graphs.
+ */
+template <class Graph, class Vertex>
+class WeightedShellIndex : public IShellIndex<Graph, Vertex>
+{
+public:
+    typedef typename IShellIndex<Graph, Vertex>::ShellIndexContainer ShellIndexContainer;
+    typedef typename IShellIndex<Graph, Vertex>::ShellIndexIterator ShellIndexIterator;
+
+    WeightedShellIndex(Graph& g)
+    {
+        const CompactGraph<Graph, Vertex> compact(g);
+        const std::vector<double> cores = strengthCoreNumbers(compact);
+        for (unsigned int i = 0; i < compact.verticesCount(); ++i)
+            shellIndex[compact.vertex(i)->getVertexId()] = cores[i];
+    }
+
+    virtual ShellIndexIterator iterator()
+    {
+        return ShellIndexIterator(shellIndex);
+    }
+
+private:
+    ShellIndexContainer shellIndex;
+};
+}  // namespace graphpp
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -2229,179 +2230,37 @@ void MainWindow::on_actionBoxplotCC_triggered()
 
 std::vector<graphpp::Boxplotentry> MainWindow::computeBpentries()
 {
-    VariantsSet& degrees = propertyMap.getPropertySet("degreeDistribution");
-    VariantsSet::const_iterator it = degrees.begin();
     auto clusteringCoefficient = factory->createClusteringCoefficient();
-    double cc = 0;
-    std::vector<graphpp::Boxplotentry> bpentries;
-    while (it != degrees.end())
-    {
-        // this calculates the Mean CC for a degree. I think it's unnecesary..
-        cc = clusteringCoefficient->clusteringCoefficient(
-            graph, from_string<unsigned int>(it->first));
-
-        // Starting here: instead of calling a function at ClusteringCoefficient.h, I've put
-        // everything here because the other way was not working.
-
-        Graph& g = graph;
-        unsigned int d = from_string<unsigned int>(it->first);
-        auto vit = g.verticesIterator();
-        std::vector<double> clusteringCoefs;
-
-        while (!vit.end())
-        {
-            Vertex* v = *vit;
-
-            if (v->degree() == d)
-            {
-                double c = clusteringCoefficient->vertexClusteringCoefficient(v);
-                clusteringCoefs.push_back(c);
-            }
-
-            ++vit;
-        }
-        // to here
-
-        std::sort(begin(clusteringCoefs), end(clusteringCoefs));
-        graphpp::Boxplotentry entry;
-        if (clusteringCoefs.size() > 0)
-        {
-            entry.degree = d;
-            entry.mean = cc;
-            entry.min = clusteringCoefs.front();
-            entry.max = clusteringCoefs.back();
-            int const Q1 = clusteringCoefs.size() / 4;
-            int const Q2 = clusteringCoefs.size() / 2;
-            int const Q3 = clusteringCoefs.size() * (0.75);
-            entry.Q1 = clusteringCoefs.at(Q1);
-            entry.Q2 = clusteringCoefs.at(Q2);
-            entry.Q3 = clusteringCoefs.at(Q3);
-            for (auto& coef : clusteringCoefs)
-                entry.values.push_back(coef);
-        }
-
-        bpentries.push_back(entry);
-        clusteringCoefs.clear();
-
-        ++it;
-    }
-
-    std::sort(begin(bpentries), end(bpentries));
+    std::vector<graphpp::Boxplotentry> bpentries =
+        clusteringCoefficient->clusteringCoefficientByDegree(graph);
+    delete clusteringCoefficient;
     return bpentries;
 }
 
 graphpp::Boxplotentry MainWindow::computeTotalBpEntries()
 {
-    Graph& g = graph;
-    auto vit = g.verticesIterator();
-    std::vector<double> clusteringCoefs;
     auto clusteringCoefficient = factory->createClusteringCoefficient();
-    double coefSums = 0.0;
-    unsigned int count = 0;
-    double oldCoef;
-    int degree_exists = propertyMap.containsPropertySet("clusteringCoeficientForDegreeO") ? 1 : 0;
+    std::vector<double> clusteringCoefs =
+        clusteringCoefficient->vertexClusteringCoefficients(graph);
+    delete clusteringCoefficient;
 
-    while (!vit.end())
+    // Kept for the queries of single vertices.
+    auto vit = graph.verticesIterator();
+    for (unsigned int i = 0; !vit.end(); ++vit, ++i)
     {
-        Vertex* v = *vit;
-        if (!propertyMap.containsProperty(
-                "clusteringCoeficientForDegreeO", to_string<unsigned int>(v->degree())))
-        {
-            oldCoef = 0;
-        }
-        else
-        {
-            oldCoef = propertyMap.getProperty<double>(
-                "clusteringCoeficientForDegreeO", to_string<unsigned int>(v->degree()));
-        }
-        double c = clusteringCoefficient->vertexClusteringCoefficient(v);
         propertyMap.addProperty<double>(
-            "clusteringCoeficientForVertex", to_string<unsigned int>(v->getVertexId()), c);
-        if (degree_exists == 0)
-            propertyMap.addProperty<double>(
-                "clusteringCoeficientForDegreeO", to_string<unsigned int>(v->degree()),
-                oldCoef + (c / propertyMap.getProperty<double>(
-                                   "degreeDistribution", to_string<unsigned int>(v->degree()))));
-        clusteringCoefs.push_back(c);
-        coefSums += c;
-        ++vit;
-        count++;
+            "clusteringCoeficientForVertex", to_string<unsigned int>((*vit)->getVertexId()),
+            clusteringCoefs[i]);
     }
-    std::sort(clusteringCoefs.begin(), clusteringCoefs.end());
-    graphpp::Boxplotentry entry;
-    if (clusteringCoefs.size() > 0)
-    {
-        entry.mean = count == 0 ? 0 : coefSums / count;
-        entry.min = clusteringCoefs.front();
-        entry.max = clusteringCoefs.back();
-        int const Q1 = clusteringCoefs.size() / 4;
-        int const Q2 = clusteringCoefs.size() / 2;
-        int const Q3 = clusteringCoefs.size() * (0.75);
-        entry.Q1 = clusteringCoefs.at(Q1);
-        entry.Q2 = clusteringCoefs.at(Q2);
-        entry.Q3 = clusteringCoefs.at(Q3);
-        for (auto& coef : clusteringCoefs)
-            entry.values.push_back(coef);
-    }
-    clusteringCoefs.clear();
-    return entry;
+    return graphpp::Boxplotentry::summarize(0, std::move(clusteringCoefs));
 }
 
 graphpp::Boxplotentry MainWindow::computeTotalBpEntriesKnn()
 {
-    Graph& g = graph;
-    auto vit = g.verticesIterator();
-    std::vector<double> nnCoefs;
     auto nearestNeighborDegree = factory->createNearestNeighborsDegree();
-    double coefSums = 0.0;
-    unsigned int count = 0;
-
-    double oldCoef;
-    int degree_exists = propertyMap.containsPropertySet("nearestNeighborDegreeForDegreeO") ? 1 : 0;
-
-    while (!vit.end())
-    {
-        Vertex* v = *vit;
-        if (!propertyMap.containsProperty(
-                "nearestNeighborDegreeForDegreeO", to_string<unsigned int>(v->degree())))
-        {
-            oldCoef = 0;
-        }
-        else
-        {
-            oldCoef = propertyMap.getProperty<double>(
-                "nearestNeighborDegreeForDegreeO", to_string<unsigned int>(v->degree()));
-        }
-        auto c = nearestNeighborDegree->meanDegreeForVertex(v);
-        propertyMap.addProperty<double>(
-            "nearestNeighborDegreeForVertex", to_string<unsigned int>(v->getVertexId()), c);
-        if (degree_exists == 0)
-            propertyMap.addProperty<double>(
-                "nearestNeighborDegreeForDegreeO", to_string<unsigned int>(v->degree()),
-                oldCoef + (c / propertyMap.getProperty<double>(
-                                   "degreeDistribution", to_string<unsigned int>(v->degree()))));
-        nnCoefs.push_back(c);
-        coefSums += c;
-        ++vit;
-        count++;
-    }
-    std::sort(nnCoefs.begin(), nnCoefs.end());
-    graphpp::Boxplotentry entry;
-    if (nnCoefs.size() > 0)
-    {
-        entry.mean = count == 0 ? 0 : coefSums / count;
-        entry.min = nnCoefs.front();
-        entry.max = nnCoefs.back();
-        int const Q1 = nnCoefs.size() / 4;
-        int const Q2 = nnCoefs.size() / 2;
-        int const Q3 = nnCoefs.size() * (0.75);
-        entry.Q1 = nnCoefs.at(Q1);
-        entry.Q2 = nnCoefs.at(Q2);
-        entry.Q3 = nnCoefs.at(Q3);
-        for (auto& coef : nnCoefs)
-            entry.values.push_back(coef);
-    }
-    nnCoefs.clear();
+    graphpp::Boxplotentry entry =
+        graphpp::Boxplotentry::summarize(0, nearestNeighborDegree->vertexMeanDegrees(graph));
+    delete nearestNeighborDegree;
     return entry;
 }
 
@@ -2690,65 +2549,10 @@ void MainWindow::on_actionBoxplotNearestNeighborsDegree_triggered()
 
 std::vector<graphpp::Boxplotentry> MainWindow::computeBpentriesKnn()
 {
-    VariantsSet& degrees = propertyMap.getPropertySet("degreeDistribution");
-    VariantsSet::const_iterator it = degrees.begin();
     auto nearestNeighborDegree = factory->createNearestNeighborsDegree();
-    double nnd = 0;
-    std::vector<graphpp::Boxplotentry> bpentries;
-    while (it != degrees.end())
-    {
-        // this calculates the Mean Knn for a degree. I think it's unnecesary..
-        nnd = nearestNeighborDegree->meanDegree(graph, from_string<unsigned int>(it->first));
-
-        // Starting here: instead of calling a function at NearestNeighborsDegree.h, I've put
-        // everything here because the other way was not working.
-
-        Graph& g = graph;
-        INearestNeighborsDegree<Graph, Vertex>::Degree d = from_string<unsigned int>(it->first);
-        auto vit = g.verticesIterator();
-        std::vector<double> nnCoefs;
-
-        while (!vit.end())
-        {
-            Vertex* v = *vit;
-
-            if (v->degree() == d)
-            {
-                auto c = nearestNeighborDegree->meanDegreeForVertex(v);
-                nnCoefs.push_back(c);
-            }
-
-            ++vit;
-        }
-        // to here
-
-        std::sort(nnCoefs.begin(), nnCoefs.end());
-        // Ok, we are using 'Boxplotentry' from clustering coefficient,
-        // but it's a common class.. We should put it in a common location.
-        graphpp::Boxplotentry entry;
-        if (nnCoefs.size() > 0)
-        {
-            entry.degree = d;
-            entry.mean = nnd;
-            entry.min = nnCoefs.front();
-            entry.max = nnCoefs.back();
-            int const Q1 = nnCoefs.size() / 4;
-            int const Q2 = nnCoefs.size() / 2;
-            int const Q3 = nnCoefs.size() * (0.75);
-            entry.Q1 = nnCoefs.at(Q1);
-            entry.Q2 = nnCoefs.at(Q2);
-            entry.Q3 = nnCoefs.at(Q3);
-            for (auto& coef : nnCoefs)
-                entry.values.push_back(coef);
-        }
-
-        bpentries.push_back(entry);
-        nnCoefs.clear();
-
-        ++it;
-    }
-
-    std::sort(bpentries.begin(), bpentries.end());
+    std::vector<graphpp::Boxplotentry> bpentries =
+        nearestNeighborDegree->meanDegreeByDegree(graph);
+    delete nearestNeighborDegree;
     return bpentries;
 }
 
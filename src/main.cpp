@@ -55,6 +55,111 @@ int main(int argc, char* argv[])
             ERROR_EXIT;
         }
 
+        if (args_info->threads_given)
+        {
+            if (args_info->threads_arg < 0)
+            {
+                usageErrorMessage("The number of threads cannot be negative.");
+                ERROR_EXIT;
+            }
+            state->setThreads(args_info->threads_arg);
+        }
+
+        if (args_info->betweenness_epsilon_given || args_info->betweenness_time_given)
+        {
+            if (args_info->weighted_given || args_info->digraph_given)
+            {
+                usageErrorMessage(
+                    "Betweenness sampling is only supported for undirected unweighted graphs.");
+                ERROR_EXIT;
+            }
+
+            float epsilon =
+                args_info->betweenness_epsilon_given ? args_info->betweenness_epsilon_arg : 0;
+            float seconds = args_info->betweenness_time_given ? args_info->betweenness_time_arg : 0;
+            float delta = args_info->betweenness_delta_arg;
+            if (args_info->betweenness_epsilon_given)
+            {
+                VALIDATE_P(epsilon);
+            }
+            if (args_info->betweenness_time_given)
+            {
+                VALIDATE_POS(seconds);
+            }
+            VALIDATE_P(delta);
+            state->setBetweennessSampling(epsilon, delta, seconds);
+        }
+
+        if (args_info->betweenness_checkpoint_given)
+        {
+            if (args_info->betweenness_epsilon_given || args_info->betweenness_time_given)
+            {
+                usageErrorMessage("Sampled betweenness cannot be checkpointed.");
+                ERROR_EXIT;
+            }
+            float seconds = args_info->checkpoint_interval_arg;
+            VALIDATE_POS(seconds);
+            state->setBetweennessCheckpoint(args_info->betweenness_checkpoint_arg, seconds);
+        }
+
+        if (args_info->betweenness_horizon_given)
+        {
+            if (args_info->betweenness_epsilon_given || args_info->betweenness_time_given ||
+                args_info->betweenness_checkpoint_given)
+            {
+                usageErrorMessage("Bounded betweenness cannot be sampled or checkpointed.");
+                ERROR_EXIT;
+            }
+            float horizon = args_info->betweenness_horizon_arg;
+            VALIDATE_POS(horizon);
+            state->setBetweennessHorizon(horizon);
+        }
+
+        if (args_info->clustering_epsilon_given || args_info->clustering_samples_given)
+        {
+            if (args_info->weighted_given || args_info->digraph_given)
+            {
+                usageErrorMessage(
+                    "Clustering sampling is only supported for undirected unweighted graphs.");
+                ERROR_EXIT;
+            }
+
+            float epsilon =
+                args_info->clustering_epsilon_given ? args_info->clustering_epsilon_arg : 0;
+            int samples =
+                args_info->clustering_samples_given ? args_info->clustering_samples_arg : 0;
+            float delta = args_info->clustering_delta_arg;
+            if (args_info->clustering_epsilon_given)
+            {
+                VALIDATE_P(epsilon);
+            }
+            if (args_info->clustering_samples_given)
+            {
+                VALIDATE_POS(samples);
+            }
+            VALIDATE_P(delta);
+            state->setClusteringSampling(epsilon, delta, samples);
+        }
+
+        if (args_info->weighted_clustering_given)
+        {
+            const std::string definition = args_info->weighted_clustering_arg;
+            if (!args_info->weighted_given)
+            {
+                usageErrorMessage("The weighted clustering definition needs a weighted graph.");
+                ERROR_EXIT;
+            }
+            if (definition == "onnela")
+            {
+                state->setWeightedClustering(ONNELA);
+            }
+            else if (definition != "barrat")
+            {
+                usageErrorMessage("The weighted clustering definition must be barrat or onnela.");
+                ERROR_EXIT;
+            }
+        }
+
         if (args_info->input_file_given)
         {
             if (args_info->erdos_given || args_info->barabasi_given || args_info->hot_given ||
@@ -380,6 +485,7 @@ int main(int argc, char* argv[])
                 std::cout << "Q3:" + to_string(entry.Q3) + ".\n";
                 std::cout << "Max:" + to_string(entry.max) + ".\n";
                 std::cout << "Mean:" + to_string(entry.mean) + ".\n";
+                std::cout << "Assortativity:" + to_string(state->assortativity()) + ".\n";
             }
             else
             {
@@ -473,15 +579,31 @@ int main(int argc, char* argv[])
             if (args_info->betweenness_output_given || args_info->ddist_output_given ||
                 args_info->clustering_output_given || args_info->maxCliqueExact_output_given ||
                 args_info->maxCliqueAprox_output_given || args_info->knn_output_given ||
-                args_info->shell_output_given)
+                args_info->shell_output_given || args_info->edge_betweenness_output_given ||
+                args_info->truss_output_given || args_info->truss_dist_output_given ||
+                args_info->dcore_output_given || args_info->closeness_output_given ||
+                args_info->distance_output_given || args_info->clustering_summary_output_given)
             {
                 std::string functionMessage = "";
 
                 if (args_info->betweenness_output_given)
                 {
-                    state->exportBetweennessVsDegree(path);
+                    try
+                    {
+                        state->exportBetweennessVsDegree(path);
+                    }
+                    catch (const GraphException& e)
+                    {
+                        errorMessage(e.what());
+                        ERROR_EXIT;
+                    }
                     functionMessage = "betweenness";
                 }
+                else if (args_info->edge_betweenness_output_given)
+                {
+                    state->exportEdgeBetweenness(path);
+                    functionMessage = "edge betweenness";
+                }
                 else if (args_info->ddist_output_given)
                 {
                     state->exportDegreeDistribution(
@@ -493,22 +615,75 @@ int main(int argc, char* argv[])
                     state->exportClusteringVsDegree(path);
                     functionMessage = "clustering coefficient";
                 }
+                else if (args_info->clustering_summary_output_given)
+                {
+                    if (state->isDigraph())
+                    {
+                        errorMessage("Transitivity for directed graphs is not supported.");
+                        ERROR_EXIT;
+                    }
+                    state->exportClusteringSummary(path);
+                    functionMessage = "clustering summary";
+                }
                 else if (args_info->knn_output_given)
                 {
                     state->exportNearestNeighborsDegreeVsDegree(path);
                     functionMessage = "nearest neighbors degree";
                 }
                 else if (args_info->shell_output_given)
+                {
+                    state->exportShellIndexVsDegree(path);
+                    functionMessage = "shellIndex";
+                }
+                else if (args_info->truss_output_given || args_info->truss_dist_output_given)
+                {
+                    if (state->isDigraph())
+                    {
+                        errorMessage("Truss decomposition for directed graphs is not supported.");
+                        ERROR_EXIT;
+                    }
+                    else if (args_info->truss_output_given)
+                    {
+                        state->exportTrussNumbers(path);
+                        functionMessage = "truss numbers";
+                    }
+                    else
+                    {
+                        state->exportTrussDistribution(path);
+                        functionMessage = "truss distribution";
+                    }
+                }
+                else if (args_info->dcore_output_given)
+                {
+                    if (!state->isDigraph())
+                    {
+                        errorMessage("D-cores are only defined for directed graphs.");
+                        ERROR_EXIT;
+                    }
+                    else
+                    {
+                        state->exportDCoreDistribution(path);
+                        functionMessage = "D-core distribution";
+                    }
+                }
+                else if (args_info->closeness_output_given ||
+                         args_info->distance_output_given)
                 {
                     if (state->isWeighted())
                     {
-                        errorMessage("Shell index for weighted graphs is not supported.");
+                        errorMessage("Shortest path lengths for weighted graphs are not "
+                                     "supported.");
                         ERROR_EXIT;
                     }
+                    else if (args_info->closeness_output_given)
+                    {
+                        state->exportCloseness(path);
+                        functionMessage = "closeness";
+                    }
                     else
                     {
-                        state->exportShellIndexVsDegree(path);
-                        functionMessage = "shellIndex";
+                        state->exportDistanceDistribution(path);
+                        functionMessage = "distance distribution";
                     }
                 }
                 if (args_info->maxCliqueExact_output_given)
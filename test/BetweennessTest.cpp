@@ -1,5 +1,7 @@
 
 #include <gtest/gtest.h>
+#include <cstdio>
+#include <limits>
 #include <set>
 #include <vector>
 #include <list>
@@ -7,7 +9,19 @@
 #include "AdjacencyListVertex.h"
 #include "AdjacencyListGraph.h"
 #include "GraphExceptions.h"
+#include "ApproximateBetweenness.h"
 #include "Betweenness.h"
+#include "BiconnectedComponents.h"
+#include "BoundedBetweenness.h"
+#include "BrandesKernel.h"
+#include "CheckpointedBetweenness.h"
+#include "CompactGraph.h"
+#include "DirectedBetweenness.h"
+#include "DynamicBetweenness.h"
+#include "EdgeBetweenness.h"
+#include "WeightedBetweenness.h"
+#include "typedefs.h"
+#include "RandomGraph.h"
 
 namespace betweennessTest
 {
@@ -15,6 +29,69 @@ namespace betweennessTest
 using namespace graphpp;
 using namespace std;
 using ::testing::Test;
+using namespace randomGraph;
+
+// Betweenness counting the pairs at most horizon apart, from all-pairs distances and path
+// counts found by a quadratic Dijkstra from every vertex.
+template <class Compact>
+std::vector<double> bruteForceBounded(const Compact& graph, double horizon)
+{
+    const unsigned int n = graph.verticesCount();
+    const double infinite = std::numeric_limits<double>::infinity();
+    std::vector<std::vector<double>> distance(n, std::vector<double>(n, infinite));
+    std::vector<std::vector<double>> sigma(n, std::vector<double>(n, 0.0));
+    for (unsigned int s = 0; s < n; s++)
+    {
+        std::vector<bool> done(n, false);
+        distance[s][s] = 0.0;
+        sigma[s][s] = 1.0;
+        for (unsigned int round = 0; round < n; round++)
+        {
+            unsigned int v = n;
+            for (unsigned int u = 0; u < n; u++)
+                if (!done[u] && distance[s][u] < infinite &&
+                    (v == n || distance[s][u] < distance[s][v]))
+                    v = u;
+            if (v == n)
+                break;
+            done[v] = true;
+            for (std::size_t e = graph.offset(v); e < graph.offset(v + 1); e++)
+            {
+                const unsigned int w = graph.target(e);
+                const double alternative = distance[s][v] + graph.weight(e);
+                if (alternative < distance[s][w])
+                {
+                    distance[s][w] = alternative;
+                    sigma[s][w] = 0.0;
+                }
+                if (alternative == distance[s][w])
+                    sigma[s][w] += sigma[s][v];
+            }
+        }
+    }
+
+    std::vector<double> result(n, 0.0);
+    for (unsigned int s = 0; s < n; s++)
+        for (unsigned int t = 0; t < n; t++)
+            for (unsigned int v = 0; v < n; v++)
+                if (v != s && v != t && s != t && distance[s][t] <= horizon &&
+                    distance[s][v] + distance[v][t] == distance[s][t])
+                    result[v] += sigma[s][v] * sigma[v][t] / sigma[s][t];
+    return result;
+}
+
+template <class Graph, class Vertex>
+void expectBounded(Graph& g, double horizon)
+{
+    CompactGraph<Graph, Vertex> compact(g);
+    const std::vector<double> expected = bruteForceBounded(compact, horizon);
+    BoundedBetweenness<Graph, Vertex> bounded(g, horizon, 2);
+    for (auto it = bounded.iterator(); !it.end(); ++it)
+    {
+        const double value = expected[compact.indexOf(it->first)];
+        ASSERT_NEAR(value, it->second, 1e-9 * (1.0 + value));
+    }
+}
 
 class BetweennessTest : public Test
 {
@@ -83,5 +160,444 @@ TEST_F(BetweennessTest , BetweennessTest)
     }
 }
 
+TEST_F(BetweennessTest, StarBetweenness)
+{
+    IndexedGraph ig;
+    Vertex* x = new Vertex(1);
+    Vertex* v1 = new Vertex(2);
+    Vertex* v2 = new Vertex(3);
+    Vertex* v3 = new Vertex(4);
+    Vertex* v4 = new Vertex(5);
+
+    ig.addVertex(x);
+    ig.addVertex(v1);
+    ig.addVertex(v2);
+    ig.addVertex(v3);
+    ig.addVertex(v4);
+
+    ig.addEdge(x, v1);
+    ig.addEdge(x, v2);
+    ig.addEdge(x, v3);
+    ig.addEdge(v1, v2);
+    ig.addEdge(x, v4);
+
+    Betweenness<IndexedGraph, Vertex> betweenness(ig, 3);
+
+    // The center is on the only shortest path of the 5 non adjacent pairs, counted both ways.
+    auto it = betweenness.iterator();
+    while (!it.end())
+    {
+        ASSERT_DOUBLE_EQ(it->first == 1 ? 10.0 : 0.0, it->second);
+        ++it;
+    }
 }
 
+TEST_F(BetweennessTest, ThreadedMatchesSerial)
+{
+    IndexedGraph ig;
+    const unsigned int n = 120;
+    ringWithChords<Vertex>(ig, n);
+
+    Betweenness<IndexedGraph, Vertex> serial(ig, 1);
+    Betweenness<IndexedGraph, Vertex> threaded(ig, 4);
+
+    auto serialIt = serial.iterator();
+    auto threadedIt = threaded.iterator();
+    while (!serialIt.end())
+    {
+        ASSERT_FALSE(threadedIt.end());
+        ASSERT_EQ(serialIt->first, threadedIt->first);
+        ASSERT_NEAR(serialIt->second, threadedIt->second, 1e-9 * (1.0 + serialIt->second));
+        ++serialIt;
+        ++threadedIt;
+    }
+    ASSERT_TRUE(threadedIt.end());
+}
+
+TEST_F(BetweennessTest, BatchedMatchesSingleSource)
+{
+    IndexedGraph ig;
+    const unsigned int n = 149;
+    ringWithChords<Vertex>(ig, n);
+
+    typedef CompactGraph<IndexedGraph, Vertex> Compact;
+    Compact compact(ig);
+    std::vector<double> edges, edges64, edges256;
+    const std::vector<double> single =
+        brandesBetweenness<BrandesKernel<Compact>>(compact, 1, &edges);
+    // 149 sources make two full batches of 64 and a partial one, or a single partial one.
+    const std::vector<double> batched64 =
+        brandesBetweenness<MultiSourceBrandesKernel<Compact, 1>>(compact, 2, &edges64);
+    const std::vector<double> batched256 =
+        brandesBetweenness<MultiSourceBrandesKernel<Compact, 4>>(compact, 1, &edges256);
+
+    for (unsigned int v = 0; v < n; v++)
+    {
+        ASSERT_NEAR(single[v], batched64[v], 1e-9 * (1.0 + single[v]));
+        ASSERT_NEAR(single[v], batched256[v], 1e-9 * (1.0 + single[v]));
+    }
+    for (std::size_t e = 0; e < edges.size(); e++)
+    {
+        ASSERT_NEAR(edges[e], edges64[e], 1e-9 * (1.0 + edges[e]));
+        ASSERT_NEAR(edges[e], edges256[e], 1e-9 * (1.0 + edges[e]));
+    }
+}
+
+TEST_F(BetweennessTest, BiconnectedMatchesPlain)
+{
+    // Two rings with chords joined by a path, pendant trees, a doubled edge, a separate
+    // triangle and an isolated vertex.
+    IndexedGraph ig(false, true);
+    const unsigned int n = 90;
+    const std::vector<Vertex*> vertices = addVertices<Vertex>(ig, n);
+    for (unsigned int i = 0; i < 30; i++)
+    {
+        ig.addEdge(vertices[i], vertices[(i + 1) % 30]);
+        ig.addEdge(vertices[30 + i], vertices[30 + (i + 1) % 30]);
+        if (i % 6 == 0)
+            ig.addEdge(vertices[i], vertices[(i + 13) % 30]);
+    }
+    ig.addEdge(vertices[5], vertices[60]);
+    ig.addEdge(vertices[60], vertices[61]);
+    ig.addEdge(vertices[61], vertices[45]);
+    for (unsigned int i = 62; i < 80; i++)
+        ig.addEdge(vertices[i], vertices[i % 3 == 0 ? i - 1 : (i * 7) % 60]);
+    ig.addEdge(vertices[61], vertices[45]);
+    ig.addEdge(vertices[80], vertices[81]);
+    ig.addEdge(vertices[81], vertices[82]);
+    ig.addEdge(vertices[82], vertices[80]);
+    for (unsigned int i = 83; i < 89; i++)
+        ig.addEdge(vertices[i], vertices[i - 3]);
+
+    typedef CompactGraph<IndexedGraph, Vertex> Compact;
+    Compact compact(ig);
+    const std::vector<double> plain = unweightedBetweenness(compact, 1);
+    const std::vector<double> blocks = biconnectedBetweenness(compact, 2);
+    for (unsigned int v = 0; v < n; v++)
+        ASSERT_NEAR(plain[v], blocks[v], 1e-9 * (1.0 + plain[v]));
+    ASSERT_EQ(0.0, blocks[compact.indexOf(89)]);
+
+    BiconnectedComponents<Compact> components(compact);
+    for (std::size_t b = 0; b < components.blocksCount(); b++)
+    {
+        double reach = 0.0;
+        for (const double r : components.reach(b))
+            reach += r;
+        ASSERT_EQ(components.componentSize(components.vertices(b).front()), reach);
+    }
+}
+
+TEST_F(BetweennessTest, CheckpointedResumes)
+{
+    IndexedGraph ig;
+    const unsigned int n = 2500;
+    const std::vector<Vertex*> vertices = addVertices<Vertex>(ig, n);
+    for (unsigned int i = 0; i < n; i++)
+    {
+        ig.addEdge(vertices[i], vertices[(i + 1) % n]);
+        Vertex* chord = vertices[(i * 37 + 5) % n];
+        if (i % 3 == 0 && chord != vertices[i] && !vertices[i]->isNeighbourOf(chord))
+            ig.addEdge(vertices[i], chord);
+    }
+
+    typedef CheckpointedBetweenness<IndexedGraph, Vertex> Checkpointed;
+    // Named after the test, and cleared first in case a failed run left it behind.
+    const ::testing::TestInfo* test = ::testing::UnitTest::GetInstance()->current_test_info();
+    const std::string path = ::testing::TempDir() + test->test_suite_name() + "." +
+                             test->name() + ".checkpoint";
+    std::remove(path.c_str());
+    Checkpointed uninterrupted(ig, path, 0.0, 1);
+    ASSERT_EQ(0, uninterrupted.resumedSources());
+
+    // Stop after the first round, then pick up from the file it leaves behind.
+    Checkpointed interrupted(ig, path, 1e9, 1, 1);
+    Checkpointed resumed(ig, path, 1e9, 1);
+    ASSERT_EQ(interrupted.roundSources(), resumed.resumedSources());
+    ASSERT_LT(resumed.resumedSources(), n);
+    ASSERT_EQ(nullptr, std::fopen(path.c_str(), "rb"));
+
+    Betweenness<IndexedGraph, Vertex> plain(ig, 1);
+    auto resumedIt = resumed.iterator();
+    auto uninterruptedIt = uninterrupted.iterator();
+    auto plainIt = plain.iterator();
+    while (!plainIt.end())
+    {
+        ASSERT_EQ(uninterruptedIt->second, resumedIt->second);
+        ASSERT_NEAR(plainIt->second, resumedIt->second, 1e-9 * (1.0 + plainIt->second));
+        ++resumedIt;
+        ++uninterruptedIt;
+        ++plainIt;
+    }
+
+    // A checkpoint only resumes the graph it was written for.
+    Checkpointed other(ig, path, 1e9, 1, 1);
+    ig.addEdge(vertices[0], vertices[n / 2]);
+    ASSERT_THROW(Checkpointed(ig, path, 1e9, 1), InvalidCheckpoint);
+    std::remove(path.c_str());
+}
+
+TEST_F(BetweennessTest, BoundedBetweenness)
+{
+    const unsigned int n = 60;
+    IndexedGraph ig;
+    DirectedGraph dg;
+    WeightedGraph halves, integers;
+    const std::vector<Vertex*> vertices = addVertices<Vertex>(ig, n);
+    const std::vector<DirectedVertex*> directed = addVertices<DirectedVertex>(dg, n);
+    const std::vector<WeightedVertex*> weighted = addVertices<WeightedVertex>(halves, n);
+    const std::vector<WeightedVertex*> integral = addVertices<WeightedVertex>(integers, n);
+    for (unsigned int i = 0; i < n; i++)
+    {
+        for (const unsigned int j : {(i + 1) % n, (i * 7 + 3) % n})
+        {
+            if (j == i || vertices[i]->isNeighbourOf(vertices[j]))
+                continue;
+            ig.addEdge(vertices[i], vertices[j]);
+            dg.addEdge(directed[i], directed[j]);
+            halves.addEdge(weighted[i], weighted[j], 0.5 * (1 + (i + j) % 4));
+            integers.addEdge(integral[i], integral[j], 1 + (i * j) % 3);
+        }
+    }
+
+    for (const double k : {1.0, 2.0, 3.0, 100.0})
+    {
+        expectBounded<IndexedGraph, Vertex>(ig, k);
+        expectBounded<DirectedGraph, DirectedVertex>(dg, k);
+    }
+    for (const double k : {1.0, 2.5, 4.0, 100.0})
+    {
+        expectBounded<WeightedGraph, WeightedVertex>(halves, k);
+        expectBounded<WeightedGraph, WeightedVertex>(integers, k);
+    }
+
+    // Past the diameter nothing is left out.
+    BoundedBetweenness<IndexedGraph, Vertex> bounded(ig, 100.0);
+    Betweenness<IndexedGraph, Vertex> plain(ig);
+    auto plainIt = plain.iterator();
+    for (auto it = bounded.iterator(); !it.end(); ++it, ++plainIt)
+        ASSERT_NEAR(plainIt->second, it->second, 1e-9 * (1.0 + it->second));
+}
+
+TEST_F(BetweennessTest, DirectedBetweenness)
+{
+    // The cycle 1 -> 2 -> 3 -> 1 plus the edge 2 -> 4.
+    DirectedGraph dg;
+    const std::vector<DirectedVertex*> vertices = addVertices<DirectedVertex>(dg, 4, 1);
+    dg.addEdge(vertices[0], vertices[1]);
+    dg.addEdge(vertices[1], vertices[2]);
+    dg.addEdge(vertices[2], vertices[0]);
+    dg.addEdge(vertices[1], vertices[3]);
+
+    graphpp::DirectedBetweenness<DirectedGraph, DirectedVertex> betweenness(dg, 2);
+
+    // 1 is inner to 3->2 and 3->4, 2 to 1->3, 1->4 and 3->4, and 3 to 2->1.
+    std::map<unsigned int, double> expected = {{1, 2.0}, {2, 3.0}, {3, 1.0}, {4, 0.0}};
+    auto it = betweenness.iterator();
+    while (!it.end())
+    {
+        ASSERT_DOUBLE_EQ(expected[it->first], it->second);
+        ++it;
+    }
+}
+
+TEST_F(BetweennessTest, DynamicBetweenness)
+{
+    IndexedGraph ig;
+    const unsigned int n = 40;
+    const std::vector<Vertex*> vertices = addVertices<Vertex>(ig, n);
+    // A path, so that the first insertions join far apart vertices.
+    for (unsigned int i = 0; i + 1 < n; i++)
+        ig.addEdge(vertices[i], vertices[i + 1]);
+
+    DynamicBetweenness<IndexedGraph, Vertex> dynamic(ig, 2);
+
+    const std::pair<unsigned int, unsigned int> changes[] = {
+        {0, 39}, {5, 20}, {10, 30}, {11, 29}, {5, 20}, {17, 18}, {0, 39}, {3, 33}};
+    for (const auto& change : changes)
+    {
+        Vertex* s = vertices[change.first];
+        Vertex* d = vertices[change.second];
+        if (s->isNeighbourOf(d))
+            dynamic.removeEdge(s, d);
+        else
+            dynamic.addEdge(s, d);
+        ASSERT_LE(dynamic.affectedSources(), n);
+
+        Betweenness<IndexedGraph, Vertex> fresh(ig, 1);
+        auto freshIt = fresh.iterator();
+        auto dynamicIt = dynamic.iterator();
+        while (!freshIt.end())
+        {
+            ASSERT_EQ(freshIt->first, dynamicIt->first);
+            ASSERT_NEAR(freshIt->second, dynamicIt->second, 1e-9 * (1.0 + freshIt->second));
+            ++freshIt;
+            ++dynamicIt;
+        }
+    }
+
+    // 17 - 18 sits on a cycle now; sources at the same distance of both ends are skipped.
+    dynamic.addEdge(vertices[17], vertices[18]);
+    ASSERT_LT(dynamic.affectedSources(), n);
+
+    // A duplicate edge, or a vertex the graph did not have, leaves the betweenness unchanged.
+    std::map<unsigned int, double> before;
+    for (auto it = dynamic.iterator(); !it.end(); ++it)
+        before[it->first] = it->second;
+    ASSERT_THROW(dynamic.addEdge(vertices[17], vertices[18]), DuplicateEdge);
+    Vertex stranger(n);
+    ASSERT_THROW(dynamic.addEdge(vertices[0], &stranger), VertexNotFound);
+    for (auto it = dynamic.iterator(); !it.end(); ++it)
+        ASSERT_EQ(before[it->first], it->second);
+    ASSERT_FALSE(vertices[0]->isNeighbourOf(&stranger));
+}
+
+TEST_F(BetweennessTest, ApproximateWithinEpsilon)
+{
+    IndexedGraph ig;
+    const unsigned int n = 120;
+    ringWithChords<Vertex>(ig, n);
+
+    const double epsilon = 0.02;
+    Betweenness<IndexedGraph, Vertex> exact(ig, 1);
+    ApproximateBetweenness<IndexedGraph, Vertex> serial(ig, epsilon, 0.01, 0.0, 1);
+    ApproximateBetweenness<IndexedGraph, Vertex> threaded(ig, epsilon, 0.01, 0.0, 3);
+
+    ASSERT_EQ(serial.samples(), threaded.samples());
+    ASSERT_LE(serial.epsilon(), epsilon);
+
+    auto exactIt = exact.iterator();
+    auto serialIt = serial.iterator();
+    auto threadedIt = threaded.iterator();
+    while (!exactIt.end())
+    {
+        ASSERT_EQ(exactIt->first, serialIt->first);
+        ASSERT_NEAR(exactIt->second, serialIt->second, epsilon * n * (n - 1));
+        ASSERT_DOUBLE_EQ(serialIt->second, threadedIt->second);
+        ++exactIt;
+        ++serialIt;
+        ++threadedIt;
+    }
+}
+
+TEST_F(BetweennessTest, ApproximateNeedsABound)
+{
+    IndexedGraph ig;
+    ig.addVertex(new Vertex(1));
+    ASSERT_THROW((ApproximateBetweenness<IndexedGraph, Vertex>(ig, 0.0, 0.1)), UnboundedSampling);
+}
+
+TEST_F(BetweennessTest, WeightedBetweenness)
+{
+    // Square 1-2-3-4-1 with a heavy diagonal 1-3 that ties with both sides of the square.
+    WeightedGraph wg;
+    const std::vector<WeightedVertex*> vertices = addVertices<WeightedVertex>(wg, 4, 1);
+    wg.addEdge(vertices[0], vertices[1], 1.0);
+    wg.addEdge(vertices[1], vertices[2], 1.5);
+    wg.addEdge(vertices[2], vertices[3], 0.5);
+    wg.addEdge(vertices[3], vertices[0], 2.0);
+    wg.addEdge(vertices[0], vertices[2], 2.5);
+
+    graphpp::WeightedBetweenness<WeightedGraph, WeightedVertex> betweenness(wg, 2);
+
+    // 1-3 has three shortest paths of length 2.5 (through 2, through 4 and direct), 2-4 goes
+    // through 3 (length 2) and 1-4 or 2-3 are direct.
+    std::map<unsigned int, double> expected = {
+        {1, 0.0}, {2, 2.0 / 3.0}, {3, 2.0}, {4, 2.0 / 3.0}};
+    auto it = betweenness.iterator();
+    while (!it.end())
+    {
+        ASSERT_NEAR(expected[it->first], it->second, 1e-12);
+        ++it;
+    }
+}
+
+TEST_F(BetweennessTest, IntegerWeightsOnBuckets)
+{
+    WeightedGraph wg;
+    const unsigned int n = 149;
+    // Weights from 1 to 3, with many ties between paths of the same length.
+    ringWithChords<WeightedVertex>(
+        wg, n, [&wg](WeightedVertex* a, WeightedVertex* b, unsigned int i, bool chord) {
+            wg.addEdge(a, b, chord ? 1.0 + i % 7 : 1.0 + i % 3);
+        });
+
+    typedef CompactGraph<WeightedGraph, WeightedVertex> Compact;
+    Compact compact(wg);
+    ASSERT_TRUE(compact.integralWeights());
+    ASSERT_EQ(3.0, compact.maxWeight());
+
+    std::vector<double> heapEdges, bucketEdges;
+    const std::vector<double> heap =
+        brandesBetweenness<WeightedBrandesKernel<Compact>>(compact, 1, &heapEdges);
+    const std::vector<double> buckets =
+        brandesBetweenness<WeightedBrandesKernel<Compact, BucketQueue>>(compact, 2, &bucketEdges);
+    for (unsigned int v = 0; v < n; v++)
+        ASSERT_NEAR(heap[v], buckets[v], 1e-9 * (1.0 + heap[v]));
+    for (std::size_t e = 0; e < heapEdges.size(); e++)
+        ASSERT_NEAR(heapEdges[e], bucketEdges[e], 1e-9 * (1.0 + heapEdges[e]));
+}
+
+TEST_F(BetweennessTest, EdgeBetweenness)
+{
+    IndexedGraph ig;
+    const unsigned int n = 120;
+    ringWithChords<Vertex>(ig, n);
+
+    EdgeBetweenness<IndexedGraph, Vertex> edgeBetweenness(ig, 3);
+    Betweenness<IndexedGraph, Vertex> betweenness(ig, 1);
+
+    // Every shortest path between an ordered pair crosses one edge more than it has inner
+    // vertices, and every edge is listed from both of its endpoints.
+    double edgesTotal = 0.0;
+    auto edgeIt = edgeBetweenness.edgesIterator();
+    while (!edgeIt.end())
+    {
+        ASSERT_DOUBLE_EQ(
+            edgeIt->betweenness, edgeBetweenness.edgeBetweenness(edgeIt->to, edgeIt->from));
+        edgesTotal += edgeIt->betweenness;
+        ++edgeIt;
+    }
+
+    double verticesTotal = 0.0;
+    auto it = betweenness.iterator();
+    auto fusedIt = edgeBetweenness.iterator();
+    while (!it.end())
+    {
+        ASSERT_NEAR(it->second, fusedIt->second, 1e-9 * (1.0 + it->second));
+        verticesTotal += it->second;
+        ++it;
+        ++fusedIt;
+    }
+    ASSERT_NEAR(edgesTotal / 2, verticesTotal + n * (n - 1), 1e-6);
+    ASSERT_EQ(-1.0, edgeBetweenness.edgeBetweenness(0, 2));
+}
+
+TEST_F(BetweennessTest, WeightedAndDirectedEdgeBetweenness)
+{
+    WeightedGraph wg;
+    const std::vector<WeightedVertex*> vertices = addVertices<WeightedVertex>(wg, 4, 1);
+    wg.addEdge(vertices[0], vertices[1], 1.0);
+    wg.addEdge(vertices[1], vertices[2], 1.5);
+    wg.addEdge(vertices[2], vertices[3], 0.5);
+    wg.addEdge(vertices[3], vertices[0], 2.0);
+    wg.addEdge(vertices[0], vertices[2], 2.5);
+
+    // 1-2 carries its own pair and a third of the paths between 1 and 3, both ways.
+    EdgeBetweenness<WeightedGraph, WeightedVertex> weighted(wg, 2);
+    ASSERT_NEAR(2.0 + 2.0 / 3.0, weighted.edgeBetweenness(1, 2), 1e-12);
+    ASSERT_NEAR(2.0 + 2.0 / 3.0, weighted.edgeBetweenness(2, 1), 1e-12);
+
+    // The cycle 1 -> 2 -> 3 -> 1 plus the edge 2 -> 4.
+    DirectedGraph dg;
+    const std::vector<DirectedVertex*> directedVertices = addVertices<DirectedVertex>(dg, 4, 1);
+    dg.addEdge(directedVertices[0], directedVertices[1]);
+    dg.addEdge(directedVertices[1], directedVertices[2]);
+    dg.addEdge(directedVertices[2], directedVertices[0]);
+    dg.addEdge(directedVertices[1], directedVertices[3]);
+
+    // 1 -> 2 is used by 1->2, 1->3, 1->4, 3->2 and 3->4.
+    EdgeBetweenness<DirectedGraph, DirectedVertex> directed(dg, 2);
+    ASSERT_DOUBLE_EQ(5.0, directed.edgeBetweenness(1, 2));
+    ASSERT_EQ(-1.0, directed.edgeBetweenness(2, 1));
+}
+}
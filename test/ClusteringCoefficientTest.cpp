@@ -3,17 +3,23 @@
 #include <set>
 #include <vector>
 #include <list>
+#include <map>
 
 #include "AdjacencyListVertex.h"
 #include "AdjacencyListGraph.h"
 #include "GraphExceptions.h"
 #include "ClusteringCoefficient.h"
+#include "ApproximateClustering.h"
 #include "GraphReader.h"
+#include "RandomGraph.h"
+#include "DegreeGroups.h"
 
 namespace clusterCoefficientTest
 {
 
 using namespace graphpp;
+using namespace randomGraph;
+using namespace degreeGroups;
 using namespace std;
 using ::testing::Test;
 
@@ -181,6 +187,154 @@ TEST_F(ClusteringCoefficientTest, RealWorldTest)
     c = clustering.vertexClusteringCoefficient(x);
     
     ASSERT_TRUE(fabs(c - 0.3583333) <  epsilon);
+
+    // The triangle counts of the whole graph give the same values.
+    ClusteringCoefficient<VectorGraph, Vertex> graphClustering;
+    const std::vector<double> all = graphClustering.vertexClusteringCoefficients(*g, 1);
+    const std::map<unsigned int, double> expected = {
+        {3, 0.6666667}, {174, 0.01141431}, {23148, 0.3583333}};
+    auto it = g->verticesIterator();
+    for (unsigned int i = 0; !it.end(); ++it, i++)
+    {
+        const auto found = expected.find((*it)->getVertexId());
+        if (found != expected.end())
+        {
+            ASSERT_TRUE(fabs(all[i] - found->second) < epsilon);
+        }
+    }
+}
+
+TEST_F(ClusteringCoefficientTest, TriangleCountsMatchNeighborPairs)
+{
+    // Hubs among the first vertices, with parallel edges and loops, which count once and not
+    // at all.
+    IndexedGraph g(false, true);
+    const unsigned int n = 150;
+    const std::vector<Vertex*> vertices = addVertices<Vertex>(g, n);
+    TestRandom random(9);
+    addRandomEdges(
+        g, vertices, random, 900, [n](unsigned int e) { return e % 2 == 0 ? 10 : n; }, true);
+
+    ClusteringCoefficient<IndexedGraph, Vertex> clustering;
+    const std::vector<double> all = clustering.vertexClusteringCoefficients(g, 1);
+    ASSERT_EQ(all, clustering.vertexClusteringCoefficients(g, 4));
+    auto it = g.verticesIterator();
+    for (unsigned int i = 0; !it.end(); ++it, i++)
+    {
+        std::set<Vertex*> neighbors;
+        auto neighborIt = (*it)->neighborsIterator();
+        for (; !neighborIt.end(); ++neighborIt)
+        {
+            if (*neighborIt != *it)
+                neighbors.insert(*neighborIt);
+        }
+        double pairs = 0, linked = 0;
+        for (Vertex* a : neighbors)
+        {
+            for (Vertex* b : neighbors)
+            {
+                if (a < b)
+                {
+                    pairs++;
+                    linked += a->isNeighbourOf(b);
+                }
+            }
+        }
+        const double expected = pairs == 0 ? 0 : linked / pairs;
+        ASSERT_DOUBLE_EQ(expected, all[i]);
+        ASSERT_DOUBLE_EQ(expected, clustering.vertexClusteringCoefficient(*it));
+    }
+}
+
+TEST_F(ClusteringCoefficientTest, GroupedByDegree)
+{
+    VectorGraph g(false, true);
+    GraphReader<VectorGraph, Vertex> graphReader;
+    graphReader.read(g, "TestTrees/AS_CAIDA_2008.txt");
+
+    ClusteringCoefficient<VectorGraph, Vertex> clustering;
+    const std::vector<Boxplotentry> groups = clustering.clusteringCoefficientByDegree(g, 4);
+    ASSERT_EQ(groups.size(), clustering.clusteringCoefficientByDegree(g, 1).size());
+
+    ASSERT_NO_FATAL_FAILURE(
+        checkGroupedByDegree(g, groups, clustering.vertexClusteringCoefficients(g, 1)));
+    for (const Boxplotentry& group : groups)
+        ASSERT_DOUBLE_EQ(clustering.clusteringCoefficient(g, group.degree), group.mean);
 }
+
+TEST_F(ClusteringCoefficientTest, Transitivity)
+{
+    // A triangle with a pendant vertex: 3 of its 5 wedges are closed.
+    IndexedGraph g(false, false);
+    std::vector<Vertex*> v;
+    for (unsigned int i = 0; i < 4; i++)
+    {
+        v.push_back(new Vertex(i));
+        g.addVertex(v.back());
+    }
+    g.addEdge(v[0], v[1]);
+    g.addEdge(v[1], v[2]);
+    g.addEdge(v[2], v[0]);
+    g.addEdge(v[0], v[3]);
+
+    ClusteringCoefficient<IndexedGraph, Vertex> clustering;
+    ASSERT_DOUBLE_EQ(0.6, clustering.transitivity(g, 1));
+    ASSERT_DOUBLE_EQ(0.6, clustering.IClusteringCoefficient::transitivity(g, 1));
+    ASSERT_DOUBLE_EQ((1.0 / 3 + 1 + 1) / 4, clustering.averageClusteringCoefficient(g, 1));
 }
 
+TEST_F(ClusteringCoefficientTest, WedgeSampling)
+{
+    VectorGraph g(false, true);
+    GraphReader<VectorGraph, Vertex> graphReader;
+    graphReader.read(g, "TestTrees/AS_CAIDA_2008.txt");
+
+    ClusteringCoefficient<VectorGraph, Vertex> exact;
+    ApproximateClusteringCoefficient<VectorGraph, Vertex> approximate(0.02, 1e-6);
+    const double epsilon = approximate.epsilon();
+    ASSERT_LE(epsilon, 0.02);
+
+    const double transitivity = approximate.transitivity(g, 4);
+    ASSERT_EQ(transitivity, approximate.transitivity(g, 1));
+    ASSERT_NEAR(exact.transitivity(g, 4), transitivity, epsilon);
+    ASSERT_NEAR(
+        exact.averageClusteringCoefficient(g, 4), approximate.averageClusteringCoefficient(g, 4),
+        epsilon);
+
+    const std::vector<Boxplotentry> groups = exact.clusteringCoefficientByDegree(g, 4);
+    const std::vector<Boxplotentry> estimates = approximate.clusteringCoefficientByDegree(g, 4);
+    ASSERT_EQ(groups.size(), estimates.size());
+    for (unsigned int i = 0; i < groups.size(); i++)
+    {
+        ASSERT_EQ(groups[i].degree, estimates[i].degree);
+        ASSERT_EQ(groups[i].values.size(), estimates[i].values.size());
+        ASSERT_NEAR(groups[i].mean, estimates[i].mean, epsilon);
+    }
+    ASSERT_DOUBLE_EQ(
+        estimates.back().mean, approximate.clusteringCoefficient(g, estimates.back().degree));
+
+    const std::vector<double> values = exact.vertexClusteringCoefficients(g, 4);
+    const std::vector<double> sampled = approximate.vertexClusteringCoefficients(g, 4);
+    ASSERT_EQ(values.size(), sampled.size());
+    for (unsigned int i = 0; i < values.size(); i++)
+        ASSERT_NEAR(values[i], sampled[i], epsilon);
+
+    Vertex* hub = g.getVertexById(174);
+    ASSERT_NEAR(
+        exact.vertexClusteringCoefficient(hub), approximate.vertexClusteringCoefficient(hub),
+        epsilon);
+
+    // Past the number of wedges of the graph, the values are exact and say so.
+    ASSERT_EQ(epsilon, approximate.transitivityEstimate(g, 4).error);
+    ApproximateClusteringCoefficient<VectorGraph, Vertex> enough(0.0, 0.1, 1u << 30);
+    const auto exactTransitivity = enough.transitivityEstimate(g, 4);
+    ASSERT_EQ(0.0, exactTransitivity.error);
+    ASSERT_DOUBLE_EQ(exact.transitivity(g, 4), exactTransitivity.value);
+    const auto exactAverage = enough.averageClusteringEstimate(g, 4);
+    ASSERT_EQ(0.0, exactAverage.error);
+    ASSERT_DOUBLE_EQ(exact.averageClusteringCoefficient(g, 4), exactAverage.value);
+
+    ASSERT_THROW((ApproximateClusteringCoefficient<VectorGraph, Vertex>(0.0, 0.1)),
+                 UnboundedSampling);
+}
+}
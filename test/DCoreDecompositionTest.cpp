@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "DCoreDecomposition.h"
+#include "RandomGraph.h"
+#include "typedefs.h"
+
+namespace dCoreDecompositionTest
+{
+using namespace graphpp;
+using namespace randomGraph;
+using namespace std;
+using ::testing::Test;
+
+class DCoreDecompositionTest : public Test
+{
+protected:
+    DCoreDecompositionTest() {}
+
+    virtual ~DCoreDecompositionTest() {}
+
+    virtual void SetUp() {}
+
+    virtual void TearDown() {}
+
+public:
+    typedef pair<unsigned int, unsigned int> Arc;
+
+    // Vertices of the (k, l)-D-core by the definition: keep removing the vertices with fewer
+    // than k in-neighbors or l out-neighbors left.
+    static set<unsigned int> bruteForceDCore(
+        unsigned int n, const set<Arc>& arcs, unsigned int k, unsigned int l)
+    {
+        set<unsigned int> core;
+        for (unsigned int v = 0; v < n; v++)
+            core.insert(v);
+        bool changed = true;
+        while (changed)
+        {
+            changed = false;
+            for (auto v = core.begin(); v != core.end();)
+            {
+                unsigned int in = 0, out = 0;
+                for (const Arc& a : arcs)
+                {
+                    in += a.second == *v && core.count(a.first) != 0;
+                    out += a.first == *v && core.count(a.second) != 0;
+                }
+                if (in < k || out < l)
+                {
+                    v = core.erase(v);
+                    changed = true;
+                }
+                else
+                    ++v;
+            }
+        }
+        return core;
+    }
+};
+
+TEST_F(DCoreDecompositionTest, Cycle)
+{
+    // A directed 4-cycle with a source pointing into it and a sink hanging out of it.
+    DirectedGraph g;
+    vector<DirectedVertex*> v;
+    for (unsigned int i = 0; i < 6; i++)
+    {
+        v.push_back(new DirectedVertex(i));
+        g.addVertex(v.back());
+    }
+    for (unsigned int i = 0; i < 4; i++)
+        g.addEdge(v[i], v[(i + 1) % 4]);
+    g.addEdge(v[4], v[0]);
+    g.addEdge(v[1], v[5]);
+
+    DCoreDecomposition<DirectedGraph, DirectedVertex> dcores(g);
+    ASSERT_EQ(1, dcores.inCoreNumber(0));
+    ASSERT_EQ(0, dcores.inCoreNumber(4));
+    ASSERT_EQ(1, dcores.inCoreNumber(5));
+    ASSERT_EQ(1, dcores.outCoreNumber(4, 0));
+    ASSERT_EQ(-1, dcores.outCoreNumber(4, 1));
+    ASSERT_EQ(0, dcores.outCoreNumber(5, 1));
+    ASSERT_EQ(1, dcores.outCoreNumber(2, 1));
+    ASSERT_EQ(-1, dcores.outCoreNumber(2, 2));
+
+    map<Arc, unsigned int> expected = {{{0, 0}, 6}, {{0, 1}, 5}, {{1, 0}, 5}, {{1, 1}, 4}};
+    map<Arc, unsigned int> distribution;
+    for (auto it = dcores.distribution(); !it.end(); ++it)
+        distribution[it->first] = it->second;
+    ASSERT_EQ(expected, distribution);
+}
+
+TEST_F(DCoreDecompositionTest, MatchesDefinition)
+{
+    DirectedGraph g;
+    const unsigned int n = 50;
+    const vector<DirectedVertex*> v = addVertices<DirectedVertex>(g, n);
+    // Out-degrees are spread over all vertices and in-degrees concentrated on a few, so the
+    // D-cores differ from the cores of the undirected graph.
+    TestRandom random(7);
+    addRandomEdges(g, v, random, 350, [n](unsigned int e) { return e % 3 == 0 ? n : n / 3; });
+    set<Arc> arcs;
+    for (DirectedVertex* a : v)
+    {
+        for (auto it = a->outNeighborsIterator(); !it.end(); ++it)
+            arcs.insert(Arc(a->getVertexId(), (*it)->getVertexId()));
+    }
+
+    DCoreDecomposition<DirectedGraph, DirectedVertex> dcores(g);
+    map<Arc, unsigned int> distribution;
+    for (auto it = dcores.distribution(); !it.end(); ++it)
+        distribution[it->first] = it->second;
+
+    unsigned int checked = 0;
+    for (unsigned int k = 0;; k++)
+    {
+        if (bruteForceDCore(n, arcs, k, 0).empty())
+            break;
+        for (unsigned int l = 0;; l++)
+        {
+            const set<unsigned int> core = bruteForceDCore(n, arcs, k, l);
+            if (core.empty())
+            {
+                ASSERT_EQ(0, distribution.count(Arc(k, l)));
+                break;
+            }
+            ASSERT_EQ(core.size(), distribution.at(Arc(k, l)));
+            for (unsigned int i = 0; i < n; i++)
+            {
+                ASSERT_EQ(core.count(i) != 0, dcores.outCoreNumber(i, k) >= int(l));
+                if (l == 0)
+                {
+                    ASSERT_EQ(core.count(i) != 0, dcores.inCoreNumber(i) >= k);
+                }
+            }
+            checked++;
+        }
+    }
+    ASSERT_EQ(distribution.size(), checked);
+}
+
+}  // namespace dCoreDecompositionTest
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include "Boxplotentry.h"
+
+namespace degreeGroups
+{
+/*
+ * Checks groups, as split by groupByDegree, against the value of every vertex of g in the
+ * order g iterates them: one group per degree, by increasing degree, holding the values of
+ * the vertices of that degree sorted, with their mean, extremes and quartiles. Call it inside
+ * ASSERT_NO_FATAL_FAILURE.
+ */
+template <class Graph>
+void checkGroupedByDegree(
+    Graph& g, const std::vector<graphpp::Boxplotentry>& groups, const std::vector<double>& values)
+{
+    std::map<unsigned int, std::vector<double>> expected;
+    auto it = g.verticesIterator();
+    for (std::size_t i = 0; !it.end(); ++it, ++i)
+        expected[(*it)->degree()].push_back(values[i]);
+    ASSERT_EQ(expected.size(), groups.size());
+
+    auto group = groups.begin();
+    for (auto& degree : expected)
+    {
+        std::vector<double>& own = degree.second;
+        double sum = 0.0;
+        for (const double value : own)
+            sum += value;
+        std::sort(own.begin(), own.end());
+
+        ASSERT_EQ(degree.first, group->degree);
+        ASSERT_EQ(own, group->values);
+        ASSERT_DOUBLE_EQ(sum / own.size(), group->mean);
+        ASSERT_EQ(own.front(), group->min);
+        ASSERT_EQ(own[own.size() / 4], group->Q1);
+        ASSERT_EQ(own[own.size() / 2], group->Q2);
+        ASSERT_EQ(own[std::size_t(own.size() * 0.75)], group->Q3);
+        ASSERT_EQ(own.back(), group->max);
+        ++group;
+    }
+}
+}  // namespace degreeGroups
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#include "AdjacencyListGraph.h"
+#include "AdjacencyListVertex.h"
+#include "DirectedClusteringCoefficient.h"
+#include "DirectedTriangleCensus.h"
+#include "DirectedVertexAspect.h"
+#include "RandomGraph.h"
+#include "typedefs.h"
+
+namespace directedClusteringCoefficientTest
+{
+using namespace graphpp;
+using namespace randomGraph;
+using namespace std;
+using ::testing::Test;
+
+class DirectedClusteringCoefficientTest : public Test
+{
+protected:
+    DirectedClusteringCoefficientTest() {}
+
+    virtual ~DirectedClusteringCoefficientTest() {}
+
+    virtual void SetUp() {}
+
+    virtual void TearDown() {}
+
+public:
+    // Clustering coefficient of vertex i of the given kind, straight from Fagiolo's matrix
+    // formulas on the adjacency matrix a.
+    static double fagiolo(const vector<vector<int>>& a, unsigned int i, DirectedClustering kind)
+    {
+        const unsigned int n = a.size();
+        double cycle = 0, middleman = 0, in = 0, out = 0;
+        double kIn = 0, kOut = 0, reciprocal = 0;
+        for (unsigned int j = 0; j < n; j++)
+        {
+            kIn += a[j][i];
+            kOut += a[i][j];
+            reciprocal += a[i][j] * a[j][i];
+            for (unsigned int h = 0; h < n; h++)
+            {
+                cycle += a[i][j] * a[j][h] * a[h][i];
+                middleman += a[i][j] * a[h][j] * a[h][i];
+                in += a[j][i] * a[j][h] * a[h][i];
+                out += a[i][j] * a[j][h] * a[i][h];
+            }
+        }
+        double triangles = 0, pairs = 0;
+        switch (kind)
+        {
+            case CYCLE:
+                triangles = cycle;
+                pairs = kIn * kOut - reciprocal;
+                break;
+            case MIDDLEMAN:
+                triangles = middleman;
+                pairs = kIn * kOut - reciprocal;
+                break;
+            case IN:
+                triangles = in;
+                pairs = kIn * (kIn - 1);
+                break;
+            case OUT:
+                triangles = out;
+                pairs = kOut * (kOut - 1);
+                break;
+            case TOTAL:
+                triangles = cycle + middleman + in + out;
+                pairs = (kIn + kOut) * (kIn + kOut - 1) - 2 * reciprocal;
+                break;
+        }
+        return pairs <= 0 ? 0 : triangles / pairs;
+    }
+};
+
+TEST_F(DirectedClusteringCoefficientTest, CensusMatchesFagiolo)
+{
+    // Hubs among the first vertices and many reciprocated edges.
+    DirectedGraph g;
+    const unsigned int n = 80;
+    const vector<DirectedVertex*> vertices = addVertices<DirectedVertex>(g, n);
+    TestRandom random(17);
+    addRandomEdges(g, vertices, random, 600, [n](unsigned int e) { return e % 3 == 0 ? 8 : n; });
+    // Many reciprocated edges: those out of every fourth vertex.
+    for (unsigned int i = 0; i < n; i += 4)
+    {
+        for (auto it = vertices[i]->outNeighborsIterator(); !it.end(); ++it)
+        {
+            DirectedVertex* j = static_cast<DirectedVertex*>(*it);
+            if (j != vertices[i] && !j->isNeighbourOf(vertices[i]))
+                g.addEdge(j, vertices[i]);
+        }
+    }
+    vector<vector<int>> a(n, vector<int>(n, 0));
+    for (unsigned int i = 0; i < n; i++)
+    {
+        for (auto it = vertices[i]->outNeighborsIterator(); !it.end(); ++it)
+            a[i][(*it)->getVertexId()] = 1;
+    }
+
+    DirectedClusteringCoefficient<DirectedGraph, DirectedVertex> clustering;
+    for (const DirectedClustering kind : {CYCLE, MIDDLEMAN, IN, OUT, TOTAL})
+    {
+        const vector<double> all = clustering.fagioloClusteringCoefficients(g, kind, 1);
+        ASSERT_EQ(all, clustering.fagioloClusteringCoefficients(g, kind, 4));
+        auto it = g.verticesIterator();
+        for (unsigned int v = 0; !it.end(); ++it, v++)
+            ASSERT_DOUBLE_EQ(fagiolo(a, (*it)->getVertexId(), kind), all[v]);
+    }
+
+    // The in and out flags select Fagiolo's in and out coefficients; with both, the in and
+    // out triangles are divided by the pairs of the total degree.
+    const vector<double> out = clustering.vertexClusteringCoefficients(g, true, false, 4);
+    const vector<double> in = clustering.vertexClusteringCoefficients(g, false, true, 4);
+    const vector<double> both = clustering.vertexClusteringCoefficients(g, true, true, 4);
+    ASSERT_EQ(out, clustering.vertexClusteringCoefficients(g, 4));
+    auto it = g.verticesIterator();
+    for (unsigned int v = 0; !it.end(); ++it, v++)
+    {
+        DirectedVertex* x = *it;
+        const unsigned int i = x->getVertexId();
+        ASSERT_DOUBLE_EQ(fagiolo(a, i, OUT), out[v]);
+        ASSERT_DOUBLE_EQ(fagiolo(a, i, IN), in[v]);
+        const double k = x->inOutDegree();
+        const double inPairs = x->inDegree() * (x->inDegree() - 1.0);
+        const double outPairs = x->outDegree() * (x->outDegree() - 1.0);
+        const double expected =
+            k < 2 ? 0 : (in[v] * inPairs + out[v] * outPairs) / (k * (k - 1));
+        ASSERT_NEAR(expected, both[v], 1e-12);
+
+        ASSERT_DOUBLE_EQ(out[v], clustering.vertexClusteringCoefficient(x, true, false));
+        ASSERT_DOUBLE_EQ(in[v], clustering.vertexClusteringCoefficient(x, false, true));
+        ASSERT_DOUBLE_EQ(both[v], clustering.vertexClusteringCoefficient(x, true, true));
+    }
+}
+
+TEST_F(DirectedClusteringCoefficientTest, TriangleKinds)
+{
+    // 0 -> 1 -> 2 -> 0 is a cycle for each of its vertices; 3 -> 0, 3 -> 1 and 0 -> 1 make 3
+    // an out triangle, 1 an in triangle and 0 a middleman.
+    DirectedGraph g;
+    vector<DirectedVertex*> v;
+    for (unsigned int i = 0; i < 4; i++)
+    {
+        v.push_back(new DirectedVertex(i));
+        g.addVertex(v.back());
+    }
+    g.addEdge(v[0], v[1]);
+    g.addEdge(v[1], v[2]);
+    g.addEdge(v[2], v[0]);
+    g.addEdge(v[3], v[0]);
+    g.addEdge(v[3], v[1]);
+
+    const CompactGraph<DirectedGraph, DirectedVertex> compact(g);
+    const vector<DirectedTriangles> census = directedTriangleCensus(compact);
+    const DirectedTriangles& zero = census[compact.indexOf(0)];
+    ASSERT_EQ(1u, zero.cycle);
+    ASSERT_EQ(1u, zero.middleman);
+    ASSERT_EQ(0u, zero.in);
+    ASSERT_EQ(0u, zero.out);
+    ASSERT_EQ(2u, zero.inDegree);
+    ASSERT_EQ(1u, zero.outDegree);
+    ASSERT_EQ(1u, census[compact.indexOf(1)].in);
+    ASSERT_EQ(1u, census[compact.indexOf(3)].out);
+    ASSERT_EQ(0u, census[compact.indexOf(3)].cycle);
+    ASSERT_DOUBLE_EQ(0.5, zero.clustering(CYCLE));
+    ASSERT_DOUBLE_EQ(2.0 / 6, zero.clustering(TOTAL));
+}
+
+}  // namespace directedClusteringCoefficientTest
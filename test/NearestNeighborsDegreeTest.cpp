@@ -9,11 +9,13 @@
 #include "GraphExceptions.h"
 #include "NearestNeighborsDegree.h"
 #include "GraphReader.h"
+#include "DegreeGroups.h"
 
 namespace nearestNeighborsDegreeTest
 {
 
 using namespace graphpp;
+using namespace degreeGroups;
 using namespace std;
 using ::testing::Test;
 
@@ -253,5 +255,75 @@ TEST_F(NearestNeighborsDegreeTest, RealWorldTest)
 }
 
 
+TEST_F(NearestNeighborsDegreeTest, GroupedByDegree)
+{
+    VectorGraph g(false, true);
+    GraphReader<VectorGraph, Vertex> graphReader;
+    graphReader.read(g, "TestTrees/AS_CAIDA_2008.txt");
+
+    NearestNeighborsDegree<VectorGraph, Vertex> knn;
+    const vector<Boxplotentry> groups = knn.meanDegreeByDegree(g, 4);
+    ASSERT_EQ(groups.size(), knn.meanDegreeByDegree(g, 1).size());
+
+    ASSERT_NO_FATAL_FAILURE(checkGroupedByDegree(g, groups, knn.vertexMeanDegrees(g, 1)));
+    for (const Boxplotentry& group : groups)
+        ASSERT_DOUBLE_EQ(knn.meanDegree(g, group.degree), group.mean);
+}
+
+TEST_F(NearestNeighborsDegreeTest, DegreeCorrelations)
+{
+    VectorGraph g(false, true);
+    GraphReader<VectorGraph, Vertex> graphReader;
+    graphReader.read(g, "TestTrees/AS_CAIDA_2008.txt");
+
+    NearestNeighborsDegree<VectorGraph, Vertex> knn;
+    const DegreeCorrelations correlations = knn.degreeCorrelations(g, 4);
+    const DegreeCorrelations sequential = knn.degreeCorrelations(g, 1);
+    ASSERT_EQ(sequential.knn, correlations.knn);
+    ASSERT_EQ(sequential.curve, correlations.curve);
+    ASSERT_EQ(sequential.assortativity, correlations.assortativity);
+
+    // Newman's coefficient straight from its definition over the edges, each seen from both
+    // ends.
+    double edges = 0, sum = 0, squares = 0, products = 0;
+    auto it = g.verticesIterator();
+    for (unsigned int v = 0; !it.end(); ++it, v++)
+    {
+        Vertex* x = *it;
+        ASSERT_DOUBLE_EQ(knn.meanDegreeForVertex(x), correlations.knn[v]);
+        for (auto n = x->neighborsIterator(); !n.end(); ++n)
+        {
+            edges++;
+            sum += x->degree();
+            squares += double(x->degree()) * x->degree();
+            products += double(x->degree()) * (*n)->degree();
+        }
+    }
+    const double mean = sum / edges;
+    ASSERT_NEAR((products / edges - mean * mean) / (squares / edges - mean * mean),
+                correlations.assortativity, 1e-9);
+    ASSERT_LT(correlations.assortativity, 0);
+
+    unsigned int vertices = 0;
+    for (unsigned int k = 0; k < correlations.curve.size(); k++)
+    {
+        ASSERT_DOUBLE_EQ(knn.meanDegree(g, k), correlations.meanDegree(k));
+        vertices += correlations.vertices[k];
+    }
+    ASSERT_EQ(g.verticesCount(), vertices);
+    ASSERT_EQ(0, correlations.meanDegree(correlations.curve.size()));
+
+    // A star is perfectly disassortative.
+    VectorGraph star;
+    Vertex* center = new Vertex(0);
+    star.addVertex(center);
+    for (unsigned int i = 1; i <= 5; i++)
+    {
+        Vertex* leaf = new Vertex(i);
+        star.addVertex(leaf);
+        star.addEdge(center, leaf);
+    }
+    ASSERT_DOUBLE_EQ(-1.0, knn.degreeCorrelations(star).assortativity);
 }
 
+}
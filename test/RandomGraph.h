@@ -0,0 +1,113 @@
+#pragma once
+
+#include <vector>
+
+namespace randomGraph
+{
+/**
+ * Class: TestRandom
+ * -----------------
+ * Description: Small linear congruential generator, so that the random graphs of the tests
+ * are the same on every platform and standard library.
+ */
+class TestRandom
+{
+public:
+    explicit TestRandom(unsigned int seed) : seed(seed) {}
+
+    // Value in [0, range), from the 16 high bits of the state.
+    unsigned int operator()(unsigned int range)
+    {
+        return (next() >> 16) % range;
+    }
+
+    // Value in [0, range), from the 24 high bits of the state, for ranges past 2^16.
+    unsigned int wide(unsigned int range)
+    {
+        return (next() >> 8) % range;
+    }
+
+private:
+    unsigned int next()
+    {
+        seed = seed * 1103515245 + 12345;
+        return seed;
+    }
+
+    unsigned int seed;
+};
+
+// Adds n vertices with ids first..first+n-1 to g, returning them in that order.
+template <class Vertex, class Graph>
+std::vector<Vertex*> addVertices(Graph& g, unsigned int n, unsigned int first = 0)
+{
+    std::vector<Vertex*> vertices;
+    for (unsigned int i = first; i < first + n; i++)
+    {
+        vertices.push_back(new Vertex(i));
+        g.addVertex(vertices.back());
+    }
+    return vertices;
+}
+
+/*
+ * Adds n vertices with ids 0..n-1 to g, joined in a ring, with a chord from every seventh
+ * vertex i to vertex (5i + 11) mod n, so that there are many shortest paths of different
+ * lengths. join(a, b, i, chord) adds the edge between a, the vertex i, and b, a chord or an
+ * edge of the ring.
+ */
+template <class Vertex, class Graph, class Join>
+std::vector<Vertex*> ringWithChords(Graph& g, unsigned int n, Join join)
+{
+    const std::vector<Vertex*> vertices = addVertices<Vertex>(g, n);
+    for (unsigned int i = 0; i < n; i++)
+    {
+        join(vertices[i], vertices[(i + 1) % n], i, false);
+        if (i % 7 == 0)
+            join(vertices[i], vertices[(i * 5 + 11) % n], i, true);
+    }
+    return vertices;
+}
+
+// As ringWithChords, with unweighted edges.
+template <class Vertex, class Graph>
+std::vector<Vertex*> ringWithChords(Graph& g, unsigned int n)
+{
+    return ringWithChords<Vertex>(
+        g, n, [&g](Vertex* a, Vertex* b, unsigned int, bool) { g.addEdge(a, b); });
+}
+
+/*
+ * Draws count edges, the e-th from a vertex drawn among all the given ones to one drawn among
+ * the first targets(e) of them, which makes hubs of those when targets(e) is small. Loops and
+ * repeated edges are skipped unless multigraph is set.
+ */
+template <class Graph, class Vertex, class Targets>
+void addRandomEdges(
+    Graph& g, const std::vector<Vertex*>& vertices, TestRandom& random, unsigned int count,
+    Targets targets, bool multigraph = false)
+{
+    for (unsigned int e = 0; e < count; e++)
+    {
+        Vertex* a = vertices[random(vertices.size())];
+        Vertex* b = vertices[random(targets(e))];
+        if (multigraph || (a != b && !a->isNeighbourOf(b)))
+            g.addEdge(a, b);
+    }
+}
+
+// As addRandomEdges, without loops or repeats, weighting every edge added by weight(random).
+template <class Graph, class Vertex, class Targets, class Weight>
+void addRandomWeightedEdges(
+    Graph& g, const std::vector<Vertex*>& vertices, TestRandom& random, unsigned int count,
+    Targets targets, Weight weight)
+{
+    for (unsigned int e = 0; e < count; e++)
+    {
+        Vertex* a = vertices[random(vertices.size())];
+        Vertex* b = vertices[random(targets(e))];
+        if (a != b && !a->isNeighbourOf(b))
+            g.addEdge(a, b, weight(random));
+    }
+}
+}  // namespace randomGraph
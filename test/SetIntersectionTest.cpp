@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <vector>
+
+#include "AdjacencyListGraph.h"
+#include "AdjacencyListVertex.h"
+#include "CompactGraph.h"
+#include "SetIntersection.h"
+#include "RandomGraph.h"
+
+namespace setIntersectionTest
+{
+using namespace graphpp;
+using namespace randomGraph;
+using namespace std;
+using ::testing::Test;
+
+class SetIntersectionTest : public Test
+{
+protected:
+    SetIntersectionTest() {}
+
+    virtual ~SetIntersectionTest() {}
+
+    virtual void SetUp() {}
+
+    virtual void TearDown() {}
+
+public:
+    typedef SetIntersection::Value Value;
+
+    // Sorted array of size values drawn from [0, range), distinct unless repeats is set.
+    static vector<Value> randomSet(TestRandom& random, unsigned int size, Value range, bool repeats)
+    {
+        vector<Value> values;
+        while (values.size() < size)
+        {
+            values.push_back(random.wide(range));
+            if (!repeats)
+            {
+                sort(values.begin(), values.end());
+                values.erase(unique(values.begin(), values.end()), values.end());
+            }
+        }
+        sort(values.begin(), values.end());
+        return values;
+    }
+
+    // Common values reported by the given kernel, checking the positions it reports.
+    static vector<Value> intersection(
+        SetIntersection::Kernel kernel, const vector<Value>& a, const vector<Value>& b)
+    {
+        vector<Value> common;
+        SetIntersection::intersect(
+            kernel, a.data(), a.data() + a.size(), b.data(), b.data() + b.size(),
+            [&](const Value* inA, const Value* inB) {
+                EXPECT_TRUE(inA >= a.data() && inA < a.data() + a.size());
+                EXPECT_TRUE(inB >= b.data() && inB < b.data() + b.size());
+                EXPECT_EQ(*inA, *inB);
+                common.push_back(*inA);
+            });
+        return common;
+    }
+};
+
+TEST_F(SetIntersectionTest, KernelsMatchSetIntersection)
+{
+    const SetIntersection::Kernel kernels[] = {
+        SetIntersection::MERGE, SetIntersection::GALLOPING, SetIntersection::SSE,
+        SetIntersection::AVX2};
+    const unsigned int sizes[] = {0, 1, 3, 4, 7, 8, 9, 16, 31, 100, 1000};
+    TestRandom random(11);
+    for (const unsigned int m : sizes)
+    {
+        for (const unsigned int n : sizes)
+        {
+            // Dense and sparse ranges give many and few common values.
+            for (const Value range : {2 * (m + n) + 1, 50 * (m + n) + 1})
+            {
+                const vector<Value> a = randomSet(random, m, range, false);
+                const vector<Value> b = randomSet(random, n, range, false);
+                vector<Value> expected;
+                set_intersection(a.begin(), a.end(), b.begin(), b.end(), back_inserter(expected));
+
+                for (const SetIntersection::Kernel kernel : kernels)
+                {
+                    if (SetIntersection::available(kernel))
+                    {
+                        ASSERT_EQ(expected, intersection(kernel, a, b));
+                    }
+                }
+                vector<Value> common;
+                SetIntersection::intersect(
+                    a.data(), a.data() + a.size(), b.data(), b.data() + b.size(),
+                    [&common](const Value* inA, const Value*) { common.push_back(*inA); });
+                ASSERT_EQ(expected, common);
+                ASSERT_EQ(
+                    expected.size(),
+                    SetIntersection::size(
+                        a.data(), a.data() + a.size(), b.data(), b.data() + b.size()));
+            }
+        }
+    }
+}
+
+TEST_F(SetIntersectionTest, RepeatedValues)
+{
+    const SetIntersection::Kernel kernels[] = {
+        SetIntersection::MERGE, SetIntersection::GALLOPING, SetIntersection::SSE,
+        SetIntersection::AVX2};
+    TestRandom random(5);
+    for (unsigned int round = 0; round < 200; round++)
+    {
+        const vector<Value> a = randomSet(random, 5 + round % 40, 30, true);
+        const vector<Value> b = randomSet(random, 5 + round % 23, 30, true);
+        vector<Value> expected;
+        set_intersection(a.begin(), a.end(), b.begin(), b.end(), back_inserter(expected));
+        expected.erase(unique(expected.begin(), expected.end()), expected.end());
+
+        for (const SetIntersection::Kernel kernel : kernels)
+        {
+            if (!SetIntersection::available(kernel))
+                continue;
+            vector<Value> common = intersection(kernel, a, b);
+            ASSERT_TRUE(is_sorted(common.begin(), common.end()));
+            common.erase(unique(common.begin(), common.end()), common.end());
+            ASSERT_EQ(expected, common);
+        }
+    }
+}
+
+TEST_F(SetIntersectionTest, CommonNeighbors)
+{
+    typedef AdjacencyListVertex Vertex;
+    typedef AdjacencyListGraph<Vertex> Graph;
+
+    // 0 and 1 are adjacent and share 2, joined to 0 by parallel edges, and 3; 0 has a loop.
+    Graph g(false, true);
+    vector<Vertex*> v;
+    for (unsigned int i = 0; i < 5; i++)
+    {
+        v.push_back(new Vertex(i));
+        g.addVertex(v.back());
+    }
+    g.addEdge(v[0], v[1]);
+    g.addEdge(v[0], v[2]);
+    g.addEdge(v[0], v[2]);
+    g.addEdge(v[1], v[2]);
+    g.addEdge(v[0], v[3]);
+    g.addEdge(v[1], v[3]);
+    g.addEdge(v[1], v[4]);
+    g.addEdge(v[0], v[0]);
+
+    const CompactGraph<Graph, Vertex> compact(g);
+    const unsigned int a = compact.indexOf(0);
+    const unsigned int b = compact.indexOf(1);
+    vector<Vertex::VertexId> common;
+    compact.commonNeighbors(a, b, [&](unsigned int w, size_t aw, size_t bw) {
+        ASSERT_EQ(w, compact.target(aw));
+        ASSERT_EQ(w, compact.target(bw));
+        ASSERT_TRUE(aw >= compact.offset(a) && aw < compact.offset(a + 1));
+        ASSERT_TRUE(bw >= compact.offset(b) && bw < compact.offset(b + 1));
+        common.push_back(compact.vertex(w)->getVertexId());
+    });
+    ASSERT_EQ(vector<Vertex::VertexId>({2, 3}), common);
+}
+
+}  // namespace setIntersectionTest
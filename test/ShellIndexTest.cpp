@@ -7,12 +7,19 @@
 #include "AdjacencyListVertex.h"
 #include "AdjacencyListGraph.h"
 #include "GraphExceptions.h"
+#include "CompactGraph.h"
+#include "DynamicShellIndex.h"
+#include "ParallelShellIndex.h"
 #include "ShellIndex.h"
+#include "WeightedShellIndex.h"
+#include "typedefs.h"
+#include "RandomGraph.h"
 
 namespace betweennessTest
 {
 
 using namespace graphpp;
+using namespace randomGraph;
 using namespace std;
 using ::testing::Test;
 
@@ -83,5 +90,191 @@ TEST_F(ShellIndexTest , ShellIndexTest)
     }
 }
 
+TEST_F(ShellIndexTest, MatchesNaivePeeling)
+{
+    Graph g;
+    const unsigned int n = 300;
+    const std::vector<Vertex*> vertices = addVertices<Vertex>(g, n);
+    // Denser towards the low ids, so that the cores are nested several levels deep.
+    TestRandom random(7);
+    for (unsigned int i = 0; i < n; i++)
+    {
+        for (unsigned int j = i + 1; j < n; j++)
+        {
+            if (random(i + j + 10) < 6)
+                g.addEdge(vertices[i], vertices[j]);
+        }
+    }
+
+    // Repeatedly remove every vertex of degree at most k, raising k when none is left.
+    std::vector<unsigned int> degree(n);
+    std::vector<bool> removed(n, false);
+    std::map<unsigned int, unsigned int> expected;
+    for (unsigned int i = 0; i < n; i++)
+        degree[i] = vertices[i]->degree();
+    unsigned int k = 0, left = n;
+    while (left > 0)
+    {
+        bool peeled = false;
+        for (unsigned int i = 0; i < n; i++)
+        {
+            if (removed[i] || degree[i] > k)
+                continue;
+            removed[i] = peeled = true;
+            expected[i] = k;
+            left--;
+            for (unsigned int j = 0; j < n; j++)
+                if (!removed[j] && vertices[i]->isNeighbourOf(vertices[j]))
+                    degree[j]--;
+        }
+        if (!peeled)
+            k++;
+    }
+
+    ShellIndex<Graph, Vertex> shellIndex(g);
+    unsigned int checked = 0, maximum = 0;
+    for (auto it = shellIndex.iterator(); !it.end(); ++it, checked++)
+    {
+        ASSERT_EQ(expected[it->first], it->second);
+        maximum = std::max(maximum, it->second);
+    }
+    ASSERT_EQ(n, checked);
+    ASSERT_LT(2, maximum);
+}
+
+TEST_F(ShellIndexTest, ParallelMatchesSequential)
+{
+    Graph g(false, true);
+    const unsigned int n = 6000;
+    const std::vector<Vertex*> vertices = addVertices<Vertex>(g, n);
+    // Preferential towards old vertices, with some parallel edges and self loops.
+    TestRandom random(11);
+    for (unsigned int i = 1; i < n; i++)
+    {
+        for (unsigned int j = 0; j < 1 + i % 9; j++)
+            g.addEdge(vertices[i], vertices[random.wide(i + 1)]);
+    }
+
+    ShellIndex<Graph, Vertex> sequential(g);
+    ParallelShellIndex<Graph, Vertex> parallel(g, 4);
+    auto sequentialIt = sequential.iterator();
+    auto parallelIt = parallel.iterator();
+    while (!sequentialIt.end())
+    {
+        ASSERT_EQ(sequentialIt->first, parallelIt->first);
+        ASSERT_EQ(sequentialIt->second, parallelIt->second);
+        ++sequentialIt;
+        ++parallelIt;
+    }
+    ASSERT_TRUE(parallelIt.end());
+}
+
+TEST_F(ShellIndexTest, DynamicMatchesRecomputed)
+{
+    Graph g;
+    const unsigned int n = 120;
+    const std::vector<Vertex*> vertices = addVertices<Vertex>(g, n);
+    TestRandom random(5);
+    addRandomEdges(g, vertices, random, 300, [n](unsigned int) { return n / 3; });
+
+    // Isolated until the end, and left out of the random updates.
+    Vertex* leaf = new Vertex(n);
+    g.addVertex(leaf);
+
+    DynamicShellIndex<Graph, Vertex> dynamic(g);
+    for (unsigned int step = 0; step < 400; step++)
+    {
+        Vertex* a = vertices[random(n)];
+        Vertex* b = vertices[random(step % 2 == 0 ? n : n / 3)];
+        if (a == b)
+            continue;
+        if (a->isNeighbourOf(b))
+            dynamic.removeEdge(a, b);
+        else
+            dynamic.addEdge(a, b);
+
+        ShellIndex<Graph, Vertex> recomputed(g);
+        auto dynamicIt = dynamic.iterator();
+        for (auto it = recomputed.iterator(); !it.end(); ++it, ++dynamicIt)
+        {
+            ASSERT_EQ(it->first, dynamicIt->first);
+            ASSERT_EQ(it->second, dynamicIt->second);
+        }
+        ASSERT_GE(n, dynamic.visitedVertices());
+    }
+
+    // A pendant edge only looks at the endpoint whose shell index may change.
+    ASSERT_EQ(0, dynamic.shellIndexOf(leaf));
+    dynamic.addEdge(leaf, vertices[n - 1]);
+    ASSERT_EQ(1, dynamic.shellIndexOf(leaf));
+    ASSERT_GE(2, dynamic.visitedVertices());
+}
+
+TEST_F(ShellIndexTest, WeightedMatchesDefinition)
+{
+    WeightedGraph g;
+    const unsigned int n = 80;
+    const std::vector<WeightedVertex*> vertices = addVertices<WeightedVertex>(g, n);
+    // Weights are multiples of 1/2, so that strengths are exact.
+    TestRandom random(3);
+    addRandomWeightedEdges(
+        g, vertices, random, 300, [n](unsigned int e) { return e % 2 == 0 ? n / 4 : n; },
+        [](TestRandom& r) { return 0.5 * (1 + r(6)); });
+
+    WeightedShellIndex<WeightedGraph, WeightedVertex> shellIndex(g);
+    std::map<unsigned int, double> cores;
+    std::set<double> levels;
+    for (auto it = shellIndex.iterator(); !it.end(); ++it)
+    {
+        cores[it->first] = it->second;
+        levels.insert(it->second);
+    }
+    ASSERT_EQ(n, cores.size());
+
+    // The s-core of every s, peeled by the definition.
+    auto sCore = [&](double s) {
+        std::set<unsigned int> core;
+        for (unsigned int i = 0; i < n; i++)
+            core.insert(i);
+        bool changed = true;
+        while (changed)
+        {
+            changed = false;
+            for (auto v = core.begin(); v != core.end();)
+            {
+                double strength = 0.0;
+                auto neighbors = vertices[*v]->neighborsIterator();
+                while (!neighbors.end())
+                {
+                    if (core.count((*neighbors)->getVertexId()) != 0)
+                        strength += vertices[*v]->edgeWeight(
+                            static_cast<WeightedVertex*>(*neighbors));
+                    ++neighbors;
+                }
+                if (strength < s)
+                {
+                    v = core.erase(v);
+                    changed = true;
+                }
+                else
+                    ++v;
+            }
+        }
+        return core;
+    };
+    // s-cores only change at the s-core numbers: just above one of them, the s-core is that
+    // of the next one.
+    for (auto level = levels.begin(); level != levels.end(); ++level)
+    {
+        auto next = std::next(level);
+        for (const double s : {*level, *level + 0.25})
+        {
+            const double expected = s == *level ? *level : next == levels.end() ? -1 : *next;
+            const std::set<unsigned int> core = sCore(s);
+            for (unsigned int i = 0; i < n; i++)
+                ASSERT_EQ(core.count(i) != 0, expected >= 0 && cores[i] >= expected);
+        }
+    }
 }
 
+}
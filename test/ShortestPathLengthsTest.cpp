@@ -0,0 +1,155 @@
+
+#include <gtest/gtest.h>
+#include <queue>
+#include <vector>
+
+#include "AdjacencyListVertex.h"
+#include "AdjacencyListGraph.h"
+#include "CompactGraph.h"
+#include "MultiSourceBFS.h"
+#include "ShortestPathLengths.h"
+#include "typedefs.h"
+#include "RandomGraph.h"
+
+namespace shortestPathLengthsTest
+{
+
+using namespace graphpp;
+using namespace std;
+using ::testing::Test;
+using namespace randomGraph;
+
+class ShortestPathLengthsTest : public Test
+{
+
+protected:
+
+    ShortestPathLengthsTest() { }
+
+    virtual ~ShortestPathLengthsTest() { }
+
+
+    virtual void SetUp()
+    {
+
+    }
+
+    virtual void TearDown()
+    {
+
+    }
+public:
+    typedef AdjacencyListVertex Vertex;
+    typedef AdjacencyListGraph<Vertex> Graph;
+
+};
+
+
+TEST_F(ShortestPathLengthsTest, PathGraph)
+{
+    Graph g;
+    const std::vector<Vertex*> vertices = addVertices<Vertex>(g, 5);
+    for (unsigned int i = 0; i + 1 < 5; i++)
+        g.addEdge(vertices[i], vertices[i + 1]);
+
+    ShortestPathLengths<Graph, Vertex> lengths(g);
+
+    const double expected[] = {0.0, 8.0, 6.0, 4.0, 2.0};
+    unsigned int distances = 0;
+    for (auto it = lengths.distanceIterator(); !it.end(); ++it)
+    {
+        ASSERT_EQ(expected[it->first], it->second);
+        distances++;
+    }
+    ASSERT_EQ(4, distances);
+    ASSERT_EQ(2.0, lengths.averagePathLength());
+    ASSERT_EQ(4, lengths.diameter());
+
+    auto it = lengths.closenessIterator();
+    ASSERT_EQ(0, it->first);
+    ASSERT_DOUBLE_EQ(4.0 / 10.0, it->second);
+    ++it;
+    ++it;
+    ASSERT_EQ(2, it->first);
+    ASSERT_DOUBLE_EQ(4.0 / 6.0, it->second);
+}
+
+TEST_F(ShortestPathLengthsTest, DirectedAndDisconnected)
+{
+    DirectedGraph g;
+    const std::vector<DirectedVertex*> vertices = addVertices<DirectedVertex>(g, 4);
+    // 0 -> 1 -> 2, and 3 on its own
+    g.addEdge(vertices[0], vertices[1]);
+    g.addEdge(vertices[1], vertices[2]);
+
+    ShortestPathLengths<DirectedGraph, DirectedVertex> lengths(g);
+
+    auto it = lengths.closenessIterator();
+    ASSERT_DOUBLE_EQ(2.0 / 3.0, it->second);
+    ++it;
+    ASSERT_DOUBLE_EQ(1.0, it->second);
+    ++it;
+    ASSERT_EQ(0.0, it->second);
+    ++it;
+    ASSERT_EQ(0.0, it->second);
+
+    ASSERT_EQ(4.0 / 3.0, lengths.averagePathLength());
+    ASSERT_EQ(2, lengths.diameter());
+}
+
+TEST_F(ShortestPathLengthsTest, MultiSourceMatchesBFS)
+{
+    Graph g;
+    const unsigned int n = 149;
+    ringWithChords<Vertex>(g, n);
+
+    typedef CompactGraph<Graph, Vertex> Compact;
+    Compact compact(g);
+    MultiSourceBFS<Compact, 4> search(compact);
+    std::vector<unsigned int> sources;
+    for (unsigned int s = 0; s < n; s += 3)
+        sources.push_back(s);
+    search.run(sources.data(), sources.size());
+
+    std::vector<std::vector<int>> distance(sources.size(), std::vector<int>(n, -1));
+    for (unsigned int d = 0; d < search.levels(); d++)
+    {
+        for (auto v = search.levelBegin(d); v != search.levelEnd(d); ++v)
+        {
+            v->sources.forEach([&](unsigned int lane) {
+                ASSERT_EQ(-1, distance[lane][v->vertex]);
+                distance[lane][v->vertex] = d;
+            });
+        }
+    }
+
+    for (unsigned int lane = 0; lane < sources.size(); lane++)
+    {
+        std::vector<int> expected(n, -1);
+        std::queue<unsigned int> queue;
+        expected[sources[lane]] = 0;
+        queue.push(sources[lane]);
+        while (!queue.empty())
+        {
+            const unsigned int v = queue.front();
+            queue.pop();
+            for (auto w = compact.neighborsBegin(v); w != compact.neighborsEnd(v); ++w)
+            {
+                if (expected[*w] < 0)
+                {
+                    expected[*w] = expected[v] + 1;
+                    queue.push(*w);
+                }
+            }
+        }
+        ASSERT_EQ(expected, distance[lane]);
+    }
+
+    ShortestPathLengths<Graph, Vertex> lengths(g, 2);
+    double pairs = 0.0;
+    for (auto it = lengths.distanceIterator(); !it.end(); ++it)
+        pairs += it->second;
+    ASSERT_EQ(n * (n - 1), pairs);
+}
+
+}
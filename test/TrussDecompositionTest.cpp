@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+#include <set>
+#include <vector>
+
+#include "AdjacencyListGraph.h"
+#include "AdjacencyListVertex.h"
+#include "CompactGraph.h"
+#include "TrussDecomposition.h"
+#include "RandomGraph.h"
+
+namespace trussDecompositionTest
+{
+using namespace graphpp;
+using namespace randomGraph;
+using namespace std;
+using ::testing::Test;
+
+class TrussDecompositionTest : public Test
+{
+protected:
+    TrussDecompositionTest() {}
+
+    virtual ~TrussDecompositionTest() {}
+
+    virtual void SetUp() {}
+
+    virtual void TearDown() {}
+
+public:
+    typedef AdjacencyListVertex Vertex;
+    typedef AdjacencyListGraph<Vertex> Graph;
+    typedef pair<Vertex::VertexId, Vertex::VertexId> Edge;
+
+    // Truss numbers by the definition: the k-truss is what is left after repeatedly removing
+    // the edges that close fewer than k - 2 triangles.
+    static map<Edge, unsigned int> bruteForceTruss(Graph& g)
+    {
+        set<Edge> edges;
+        auto it = g.verticesIterator();
+        while (!it.end())
+        {
+            auto neighbors = (*it)->neighborsIterator();
+            while (!neighbors.end())
+            {
+                if ((*it)->getVertexId() < (*neighbors)->getVertexId())
+                    edges.insert(Edge((*it)->getVertexId(), (*neighbors)->getVertexId()));
+                ++neighbors;
+            }
+            ++it;
+        }
+
+        map<Edge, unsigned int> truss;
+        for (unsigned int k = 2; !edges.empty(); k++)
+        {
+            bool changed = true;
+            while (changed)
+            {
+                changed = false;
+                for (auto e = edges.begin(); e != edges.end();)
+                {
+                    unsigned int triangles = 0;
+                    for (const Edge& f : edges)
+                    {
+                        if (f.first != e->first)
+                            continue;
+                        const Vertex::VertexId w = f.second;
+                        if (w != e->second &&
+                            edges.count(Edge(min(w, e->second), max(w, e->second))) != 0)
+                            triangles++;
+                    }
+                    for (const Edge& f : edges)
+                    {
+                        if (f.second == e->first && edges.count(Edge(
+                                                        min(f.first, e->second),
+                                                        max(f.first, e->second))) != 0)
+                            triangles++;
+                    }
+                    if (triangles + 2 < k + 1)
+                    {
+                        truss[*e] = k;
+                        e = edges.erase(e);
+                        changed = true;
+                    }
+                    else
+                        ++e;
+                }
+            }
+        }
+        return truss;
+    }
+};
+
+TEST_F(TrussDecompositionTest, CliqueWithTail)
+{
+    // A 4-clique 0-1-2-3, a triangle 3-4-5 hanging from it and a pendant edge 5-6.
+    Graph g;
+    vector<Vertex*> v;
+    for (unsigned int i = 0; i < 7; i++)
+    {
+        v.push_back(new Vertex(i));
+        g.addVertex(v.back());
+    }
+    for (unsigned int i = 0; i < 4; i++)
+        for (unsigned int j = i + 1; j < 4; j++)
+            g.addEdge(v[i], v[j]);
+    g.addEdge(v[3], v[4]);
+    g.addEdge(v[4], v[5]);
+    g.addEdge(v[5], v[3]);
+    g.addEdge(v[5], v[6]);
+
+    TrussDecomposition<Graph, Vertex> truss(g, 1);
+    ASSERT_EQ(4, truss.trussNumber(0, 1));
+    ASSERT_EQ(4, truss.trussNumber(3, 2));
+    ASSERT_EQ(3, truss.trussNumber(3, 4));
+    ASSERT_EQ(3, truss.trussNumber(5, 3));
+    ASSERT_EQ(2, truss.trussNumber(5, 6));
+    ASSERT_EQ(0, truss.trussNumber(0, 6));
+
+    map<unsigned int, unsigned int> expected = {{2, 1}, {3, 3}, {4, 6}};
+    map<unsigned int, unsigned int> distribution;
+    for (auto it = truss.distribution(); !it.end(); ++it)
+        distribution[it->first] = it->second;
+    ASSERT_EQ(expected, distribution);
+}
+
+TEST_F(TrussDecompositionTest, MatchesDefinition)
+{
+    Graph g;
+    const unsigned int n = 60;
+    const vector<Vertex*> v = addVertices<Vertex>(g, n);
+    // Denser among the first vertices, so that there are trusses of several orders.
+    TestRandom random(11);
+    addRandomEdges(g, v, random, 400, [n](unsigned int e) { return e % 2 == 0 ? n / 4 : n; });
+
+    const map<Edge, unsigned int> expected = bruteForceTruss(g);
+    for (unsigned int threads : {1, 4})
+    {
+        TrussDecomposition<Graph, Vertex> truss(g, threads);
+        unsigned int edges = 0;
+        for (auto it = truss.edgesIterator(); !it.end(); ++it)
+        {
+            ASSERT_LT(it->from, it->to);
+            ASSERT_EQ(expected.at(Edge(it->from, it->to)), it->truss);
+            edges++;
+        }
+        ASSERT_EQ(expected.size(), edges);
+    }
+}
+
+TEST_F(TrussDecompositionTest, ParallelPeelingMatchesSequential)
+{
+    Graph g;
+    const unsigned int n = 3000;
+    const vector<Vertex*> v = addVertices<Vertex>(g, n);
+    // Sparse enough that the first frontiers hold thousands of edges, past the cutoff.
+    TestRandom random(7);
+    addRandomEdges(g, v, random, 24000, [n](unsigned int e) { return e % 3 == 0 ? 60 : n; });
+
+    typedef CompactGraph<Graph, Vertex> Compact;
+    const Compact compact(g);
+    const UndirectedEdges<Compact> edges(compact);
+    const vector<unsigned int> support = triangleSupport(edges, 1);
+    const vector<unsigned int> expected = sequentialTrussNumbers(edges, support);
+
+    // Without the cutoff every frontier, however small, is spread among the threads.
+    for (unsigned int threads : {2, 4, 8})
+    {
+        ASSERT_EQ(expected, parallelTrussNumbers(edges, support, threads));
+        ASSERT_EQ(expected, parallelTrussNumbers(edges, support, threads, 1));
+    }
+}
+
+TEST_F(TrussDecompositionTest, IgnoresParallelEdgesAndLoops)
+{
+    Graph g(false, true);
+    vector<Vertex*> v;
+    for (unsigned int i = 0; i < 3; i++)
+    {
+        v.push_back(new Vertex(i));
+        g.addVertex(v.back());
+    }
+    g.addEdge(v[0], v[1]);
+    g.addEdge(v[0], v[1]);
+    g.addEdge(v[1], v[2]);
+    g.addEdge(v[2], v[0]);
+    g.addEdge(v[2], v[2]);
+
+    TrussDecomposition<Graph, Vertex> truss(g, 1);
+    unsigned int edges = 0;
+    for (auto it = truss.edgesIterator(); !it.end(); ++it)
+    {
+        ASSERT_EQ(3, it->truss);
+        edges++;
+    }
+    ASSERT_EQ(3, edges);
+}
+
+}  // namespace trussDecompositionTest
@@ -9,11 +9,13 @@
 #include "WeightedGraphAspect.h"
 #include "WeightedVertexAspect.h"
 #include "WeightedClusteringCoefficient.h"
+#include "RandomGraph.h"
 
 namespace weightedClusterCoefficientTest
 {
 
 using namespace graphpp;
+using namespace randomGraph;
 using namespace std;
 using ::testing::Test;
 
@@ -135,5 +137,85 @@ TEST_F(WeightedClusterCoefficientTest, SingleNodeGraph)
     ASSERT_TRUE(fabs(c2 - 0.0) <  epsilon);
 }
 
+TEST_F(WeightedClusterCoefficientTest, OnnelaTriangle)
+{
+    // A triangle weighted 1, 2 and 4 with a pendant vertex.
+    WeightedGraph g;
+    std::vector<Vertex*> v;
+    for (unsigned int i = 0; i < 4; i++)
+    {
+        v.push_back(new Vertex(i));
+        g.addVertex(v.back());
+    }
+    g.addEdge(v[0], v[1], 1);
+    g.addEdge(v[1], v[2], 2);
+    g.addEdge(v[2], v[0], 4);
+    g.addEdge(v[0], v[3], 3);
+
+    WeightedClusteringCoefficient<WeightedGraph, Vertex> barrat;
+    WeightedClusteringCoefficient<WeightedGraph, Vertex> onnela(ONNELA, 4);
+    ASSERT_DOUBLE_EQ((1 + 4) / (8.0 * 2), barrat.vertexClusteringCoefficient(v[0]));
+    ASSERT_DOUBLE_EQ(1, barrat.vertexClusteringCoefficient(v[1]));
+    ASSERT_DOUBLE_EQ(2 * 0.5 / 6, onnela.vertexClusteringCoefficient(v[0]));
+    ASSERT_DOUBLE_EQ(0.5, onnela.vertexClusteringCoefficient(v[2]));
+
+    // Built from the graph, the largest weight is taken from it.
+    WeightedClusteringCoefficient<WeightedGraph, Vertex> fromGraph(g, ONNELA);
+    ASSERT_DOUBLE_EQ(2 * 0.5 / 6, fromGraph.vertexClusteringCoefficient(v[0]));
+    ASSERT_DOUBLE_EQ(0.5, fromGraph.vertexClusteringCoefficient(v[2]));
+
+    const std::vector<double> all = onnela.vertexClusteringCoefficients(g, 1);
+    ASSERT_DOUBLE_EQ(2 * 0.5 / 6, all[0]);
+    ASSERT_DOUBLE_EQ(0.5, all[1]);
+    ASSERT_DOUBLE_EQ(0.5, all[2]);
+    ASSERT_DOUBLE_EQ(0, all[3]);
+    ASSERT_DOUBLE_EQ(0.5, onnela.clusteringCoefficient(g, 2));
+}
+
+TEST_F(WeightedClusterCoefficientTest, FusedMatchesNeighborPairs)
+{
+    WeightedGraph g;
+    const unsigned int n = 150;
+    const std::vector<Vertex*> vertices = addVertices<Vertex>(g, n);
+    TestRandom random(3);
+    addRandomWeightedEdges(
+        g, vertices, random, 900, [n](unsigned int e) { return e % 2 == 0 ? 10 : n; },
+        [](TestRandom& r) { return 1 + r(9); });
+
+    for (const WeightedClustering definition : {BARRAT, ONNELA})
+    {
+        WeightedClusteringCoefficient<WeightedGraph, Vertex> clustering(definition, 9);
+        const std::vector<double> all = clustering.vertexClusteringCoefficients(g, 1);
+        ASSERT_EQ(all, clustering.vertexClusteringCoefficients(g, 4));
+        for (unsigned int i = 0; i < n; i++)
+        {
+            // Sum over the ordered pairs of neighbors j, h of i joined by an edge.
+            Vertex* x = vertices[i];
+            double links = 0, strength = 0;
+            for (Vertex* j : vertices)
+            {
+                if (!x->isNeighbourOf(j))
+                    continue;
+                strength += x->edgeWeight(j);
+                for (Vertex* h : vertices)
+                {
+                    if (h == j || !x->isNeighbourOf(h) || !j->isNeighbourOf(h))
+                        continue;
+                    if (definition == BARRAT)
+                        links += (x->edgeWeight(j) + x->edgeWeight(h)) / 2;
+                    else
+                        links += cbrt(x->edgeWeight(j) * x->edgeWeight(h) * j->edgeWeight(h)) / 9;
+                }
+            }
+            const double k = x->degree();
+            double expected = 0;
+            if (k > 1)
+                expected = links / (definition == BARRAT ? strength * (k - 1) : k * (k - 1));
+            ASSERT_NEAR(expected, all[i], 1e-12);
+            ASSERT_NEAR(expected, clustering.vertexClusteringCoefficient(x), 1e-12);
+        }
+    }
+}
+
 }
 
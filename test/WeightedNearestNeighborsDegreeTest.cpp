@@ -10,11 +10,13 @@
 #include "WeightedGraphAspect.h"
 #include "WeightedVertexAspect.h"
 #include "WeightedNearestNeighborsDegree.h"
+#include "RandomGraph.h"
 
 namespace weightedNearestNeighborsDegreeTest
 {
 
 using namespace graphpp;
+using namespace randomGraph;
 using namespace std;
 using ::testing::Test;
 
@@ -107,5 +109,40 @@ TEST_F(WeightedNearestNeighborsDegreeTest , SingleNodeGraph)
     double epsilon = 0.001;
     ASSERT_TRUE(fabs(dx - 0.0) <  epsilon);
 }
-}
 
+TEST_F(WeightedNearestNeighborsDegreeTest , DegreeCorrelations)
+{
+    WeightedGraph g;
+    const unsigned int n = 60;
+    const vector<Vertex*> vertices = addVertices<Vertex>(g, n);
+    TestRandom random(5);
+    addRandomWeightedEdges(
+        g, vertices, random, 300, [n](unsigned int e) { return e % 2 == 0 ? 6 : n; },
+        [](TestRandom& r) { return 0.5 + r(10); });
+
+    typedef WeightedNearestNeighborsDegree<WeightedGraph, Vertex> Knn;
+    Knn knn;
+    const DegreeCorrelations correlations = knn.degreeCorrelations(g, 4);
+
+    // Leung and Chau's weighted coefficient from its definition over the edges.
+    double weights = 0, sum = 0, squares = 0, products = 0;
+    for (unsigned int v = 0; v < n; v++)
+    {
+        Vertex* x = vertices[v];
+        ASSERT_NEAR(knn.meanDegreeForVertex(x), correlations.knn[v], 1e-12);
+        for (auto it = x->neighborsIterator(); !it.end(); ++it)
+        {
+            Vertex* y = static_cast<Vertex*>(*it);
+            const double w = x->edgeWeight(y);
+            weights += w;
+            sum += w * x->degree();
+            squares += w * x->degree() * x->degree();
+            products += w * x->degree() * y->degree();
+        }
+    }
+    const double mean = sum / weights;
+    ASSERT_NEAR((products / weights - mean * mean) / (squares / weights - mean * mean),
+                correlations.assortativity, 1e-9);
+    ASSERT_NEAR(knn.meanDegree(g, 5), correlations.meanDegree(5), 1e-12);
+}
+}